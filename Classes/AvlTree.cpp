@@ -8,9 +8,9 @@
 
 // Libraries:
 #include <iostream>
-#include <iomanip>
-#include <stack>
+#include <algorithm>
 #include "AvlTree.h"
+#include "ParallelSort.h"
 
 using namespace std;
 
@@ -25,18 +25,17 @@ AvlTree::AvlTree( SortBy order )
 
 AvlTree::~AvlTree()
 {
-	// Call clear() method to remove all nodes.
-	clear();
+	// Nodes are deallocated along with the pool's slabs.
 }
 
 void AvlTree::insert( StringHashData *data )
 {
 	// If AVL tree is empty, allocate memory for root node.
 	if( isEmpty() )
-		this->root_ = new AvlTreeNode;
+		this->root_ = this->pool_.allocate();
 
 	// Insert node with data and maintain correct root (may change if rotation occurs).
-	setRoot( this->root_->insert( data, getKeyOrder() ) );
+	setRoot( this->root_->insert( data, getKeyOrder(), &this->pool_ ) );
 }
 
 void AvlTree::remove( StringHashData *data )
@@ -44,14 +43,43 @@ void AvlTree::remove( StringHashData *data )
 	// If AVL tree isn't empty and data is in the tree, remove it while maintaining
 	// correct root (may change if root is removed or rotation occurs).
 	if( !isEmpty() && search( data ) )
-		setRoot( this->root_->remove( data, getKeyOrder() ) );
+		setRoot( this->root_->remove( data, getKeyOrder(), &this->pool_ ) );
+}
+
+void AvlTree::remove( StringHashData *data, double key )
+{
+	// If data is in the tree under key, remove it while maintaining correct root.
+	if( search( data, key ) )
+		setRoot( this->root_->remove( key, data, &this->pool_ ) );
+}
+
+void AvlTree::build( std::vector< StringHashData* > data )
+{
+	// Key of each data, calculated only once (scores are derived from histograms).
+	vector< pair< double, StringHashData* > > sorted;
+	sorted.reserve( data.size() );
+	for( auto d : data )
+		sorted.emplace_back( keyOf( d ), d );
+
+	// Order as insertions do: by key, ties by word's id.
+	auto less = []( const pair< double, StringHashData* > &a, const pair< double, StringHashData* > &b )
+	{
+		return AvlTreeNode::isLower( a.first, a.second, b.first, b.second );
+	};
+
+	// Sort with one thread per core.
+	parallelSort( sorted, less );
+
+	// Release previous nodes and link a balanced tree from sorted data.
+	clear();
+	setRoot( buildSubtree( sorted, 0, sorted.size() ) );
 }
 
 void AvlTree::clear()
 {
-	// Call remove() method for all nodes.
-	while( !isEmpty() )
-		remove( getRoot()->getData() );
+	// Give every node back to the pool (no node is visited).
+	this->pool_.releaseAll();
+	setRoot( nullptr );
 }
 
 bool AvlTree::search( StringHashData *data )
@@ -64,6 +92,16 @@ bool AvlTree::search( StringHashData *data )
 	return false;
 }
 
+bool AvlTree::search( StringHashData *data, double key )
+{
+	// If AVL tree isn't empty, search for node with data under key.
+	if( !isEmpty() )
+		return getRoot()->search( key, data );
+
+	// Otherwise, return false to indicate tree is empty.
+	return false;
+}
+
 bool AvlTree::isEmpty()
 {
 	// If root is a null pointer, the tree is empty.
@@ -82,156 +120,309 @@ SortBy AvlTree::getKeyOrder()
 	return this->key_order_;
 }
 
-void AvlTree::printGreatestKeys( unsigned rank_size )
+unsigned AvlTree::getSize()
 {
-	// Copy of rank_size.
-	unsigned size = rank_size;
-	// Amount of digits in rank_size.
-	unsigned digits_amount = 0;
-	// Calculate the amount of digits in rank_size.
-	while( size > 0 )
+	// Root's subtree holds every node.
+	return isEmpty() ? 0 : getRoot()->getSize();
+}
+
+unsigned AvlTree::countLowerKeys( double key )
+{
+	// Amount of lower keys found so far.
+	unsigned count = 0;
+
+	// Descend from root: a node with a lower key counts along with its left descendants,
+	// then the search continues to the right; otherwise, to the left.
+	AvlTreeNode *node = getRoot();
+	while( node != nullptr )
 	{
-		size /= 10;
-		++digits_amount;
+		if( node->getKey() < key )
+		{
+			if( node->getLeftDescendant() != nullptr )
+				count += node->getLeftDescendant()->getSize();
+			++count;
+			node = node->getRightDescendant();
+		}
+		else
+			node = node->getLeftDescendant();
 	}
-	// Set size to 1.
-	size = 1;
 
-	// Stack to traverse tree.
-	stack< AvlTreeNode* > tree_traversal;
-	// Stack of printed words (to avoid printing again when backtracking).
-	stack< string > printed_words;
-	// Last printed or checked word.
-	string last_word;
-
-	// Push tree's root to the stack.
-	tree_traversal.push( getRoot() );
+	return count;
+}
 
-	// Print header line.
-	( getKeyOrder() == SortBy::SCORE ) ? cout << "--   Score Ranking   --\n" : cout << "-- Frequency Ranking --\n";
+unsigned AvlTree::countGreaterKeys( double key )
+{
+	// Amount of greater keys found so far.
+	unsigned count = 0;
 
-	// Search for rank_size words:
-	while( !tree_traversal.empty() && size <= rank_size )
+	// Descend from root: a node with a greater key counts along with its right descendants,
+	// then the search continues to the left; otherwise, to the right.
+	AvlTreeNode *node = getRoot();
+	while( node != nullptr )
 	{
-		// If current word was already printed, its left descendants were already checked;
-		// keep backtracking.
-		if( !printed_words.empty() &&
-				tree_traversal.top()->getData()->getWord() == printed_words.top() )
+		if( node->getKey() > key )
 		{
-			last_word = printed_words.top();
-
-			printed_words.pop();
-			tree_traversal.pop();
+			if( node->getRightDescendant() != nullptr )
+				count += node->getRightDescendant()->getSize();
+			++count;
+			node = node->getLeftDescendant();
 		}
+		else
+			node = node->getRightDescendant();
+	}
 
-		// If last word wasn't in the right descendant and there're right descendants,
-		// search for greater key among right descendants.
-		else if( tree_traversal.top()->getRightDescendant() != nullptr &&
-				tree_traversal.top()->getRightDescendant()->getData()->getWord() != last_word )
-		{
-			tree_traversal.push( tree_traversal.top()->getRightDescendant() );
-		}
+	return count;
+}
+
+unsigned AvlTree::getRank( StringHashData *data )
+{
+	// Data that isn't ranked has no rank.
+	if( !search( data ) )
+		return 0;
+
+	// Rank follows every greater key.
+	return countGreaterKeys( keyOf( data ) ) + 1;
+}
+
+StringHashData* AvlTree::select( unsigned rank )
+{
+	// Rank out of range has no word.
+	if( rank == 0 || rank > getSize() )
+		return nullptr;
+
+	// Descend from root: rank is among right descendants (greater keys), at this node,
+	// or among left descendants after skipping the others.
+	AvlTreeNode *node = getRoot();
+	while( node != nullptr )
+	{
+		unsigned greater = ( node->getRightDescendant() != nullptr ) ?
+				node->getRightDescendant()->getSize() : 0;
 
-		// There're no more right descendants:
+		if( rank <= greater )
+			node = node->getRightDescendant();
+		else if( rank == greater + 1 )
+			return node->getData();
 		else
 		{
-			// This is one of the words with the greatest keys.
-			cout << setw( digits_amount ) << setfill( '0' ) << size
-					<< ". " << tree_traversal.top()->getData()->getWord() << '\n';
-			++size;  // Increment amount of found words.
-			last_word = tree_traversal.top()->getData()->getWord();
-
-			// If last word wasn't in the left descendant and there're left descendants,
-			// search for next greater key among left descendants.
-			if( tree_traversal.top()->getLeftDescendant() != nullptr &&
-					tree_traversal.top()->getLeftDescendant()->getData()->getWord() != last_word )
-			{
-				printed_words.push( tree_traversal.top()->getData()->getWord() );
-				tree_traversal.push( tree_traversal.top()->getLeftDescendant() );
-			}
-			// Left and right descendants have been checked or do not exist, keep backtracking.
-			else
-				tree_traversal.pop();
+			rank -= greater + 1;
+			node = node->getLeftDescendant();
 		}
 	}
+
+	// Unreachable while subtrees' sizes are correct.
+	return nullptr;
+}
+
+double AvlTree::getPercentile( double key )
+{
+	// Empty tree has no percentiles.
+	if( isEmpty() )
+		return 0.0;
+
+	// Lower keys, and equal keys (neither lower nor greater).
+	unsigned lower = countLowerKeys( key );
+	unsigned equal = getSize() - lower - countGreaterKeys( key );
+
+	return 100.0 * ( lower + equal / 2.0 ) / getSize();
+}
+
+void AvlTree::getGreatestKeys( unsigned amount, std::vector< StringHashData* > &words )
+{
+	// Every key, greatest first, until amount words were found.
+	words.clear();
+	for( Iterator i = getRange( -numeric_limits< double >::infinity(), numeric_limits< double >::infinity(), true );
+			i != end() && words.size() < amount; ++i )
+		words.push_back( *i );
+}
+
+void AvlTree::getLowestKeys( unsigned amount, std::vector< StringHashData* > &words )
+{
+	// Every key, lowest first, until amount words were found.
+	words.clear();
+	for( Iterator i = getRange(); i != end() && words.size() < amount; ++i )
+		words.push_back( *i );
+}
+
+AvlTree::Iterator AvlTree::getRange( double low, double high, bool descending )
+{
+	// Seek first word from the root.
+	return Iterator( getRoot(), low, high, descending );
+}
+
+AvlTree::Iterator AvlTree::end()
+{
+	// Empty path.
+	return Iterator();
+}
+
+unsigned AvlTree::writeRange( RankingSink &sink, double low, double high, bool descending,
+		unsigned amount )
+{
+	// Write each word in range, up to amount.
+	sink.begin( getKeyOrder() );
+	for( Iterator i = getRange( low, high, descending );
+			i != end() && sink.getWrittenAmount() < amount; ++i )
+		sink.write( *i );
+	sink.end();
+
+	return sink.getWrittenAmount();
+}
+
+std::size_t AvlTree::getAllocatedBytes()
+{
+	// Return bytes of the pool's slabs.
+	return this->pool_.getAllocatedBytes();
+}
+
+void AvlTree::printGreatestKeys( unsigned rank_size )
+{
+	// Print rank_size words, greatest keys first.
+	printRanking( rank_size, true );
 }
 
 void AvlTree::printLowestKeys( unsigned rank_size )
 {
-	// Copy of rank_size.
-	unsigned size = rank_size;
+	// Print rank_size words, lowest keys first.
+	printRanking( rank_size, false );
+}
+
+void AvlTree::setRoot( AvlTreeNode *new_root )
+{
+	// Assign new_root as tree's root.
+		this->root_ = new_root;
+}
+
+AvlTreeNode* AvlTree::buildSubtree( const std::vector< std::pair< double, StringHashData* > > &sorted,
+		unsigned first, unsigned last )
+{
+	// Empty range has no nodes.
+	if( first >= last )
+		return nullptr;
+
+	// Middle element is the root, so both halves differ in size by one at most.
+	unsigned middle = first + ( last - first ) / 2;
+	AvlTreeNode *node = this->pool_.allocate();
+	node->setKey( sorted[ middle ].first );
+	node->setData( sorted[ middle ].second );
+
+	// Lower data to the left, greater data to the right.
+	node->setLeftDescendant( buildSubtree( sorted, first, middle ) );
+	node->setRightDescendant( buildSubtree( sorted, middle + 1, last ) );
+
+	// Height and balancing factor from descendants' heights.
+	int left_height = ( node->getLeftDescendant() != nullptr ) ? node->getLeftDescendant()->getHeight() : 0;
+	int right_height = ( node->getRightDescendant() != nullptr ) ? node->getRightDescendant()->getHeight() : 0;
+	node->setHeight( max( left_height, right_height ) + 1 );
+	node->setSize( last - first );
+	node->setFactor( left_height - right_height );
+
+	// Return range's root.
+	return node;
+}
+
+double AvlTree::keyOf( StringHashData *data )
+{
+	// Score or frequency, according to sorting order.
+	return ( getKeyOrder() == SortBy::SCORE ) ?
+			data->getScore() : static_cast< double >( data->getFrequency() );
+}
+
+void AvlTree::printRanking( unsigned rank_size, bool descending )
+{
 	// Amount of digits in rank_size.
 	unsigned digits_amount = 0;
-	// Calculate the amount of digits in rank_size.
-	while( size > 0 )
-	{
-		size /= 10;
+	for( unsigned size = rank_size; size > 0; size /= 10 )
 		++digits_amount;
-	}
-	// Set size to 1.
-	size = 1;
 
-	// Stack to traverse tree.
-	stack< AvlTreeNode* > tree_traversal;
-	// Stack of printed words (to avoid printing again when backtracking).
-	stack< string > printed_words;
-	// Last printed or checked word.
-	string last_word;
+	// Print every key's words, straight from the tree.
+	RankingSink sink( cout, SinkFormat::CONSOLE, digits_amount );
+	writeRange( sink, -numeric_limits< double >::infinity(), numeric_limits< double >::infinity(),
+			descending, rank_size );
+}
 
-	// Push tree's root to the stack.
-	tree_traversal.push( getRoot() );
+AvlTree::Iterator::Iterator()
+{
+	// Empty path: past the end.
+	this->low_ = 0.0;
+	this->high_ = 0.0;
+	this->descending_ = false;
+}
 
-	// Print header line.
-	( getKeyOrder() == SortBy::SCORE ) ? cout << "--   Score Ranking   --\n" : cout << "-- Frequency Ranking --\n";
+AvlTree::Iterator::Iterator( AvlTreeNode *root, double low, double high, bool descending )
+{
+	// Range and direction.
+	this->low_ = low;
+	this->high_ = high;
+	this->descending_ = descending;
 
-	// Search for rank_size words:
-	while( !tree_traversal.empty() && size <= rank_size )
-	{
-		// If current word was already printed, its right descendants were already checked;
-		// keep backtracking.
-		if( !printed_words.empty() &&
-				tree_traversal.top()->getData()->getWord() == printed_words.top() )
-		{
-			last_word = printed_words.top();
+	// Seek first word from the root.
+	descend( root );
+}
 
-			printed_words.pop();
-			tree_traversal.pop();
-		}
+StringHashData* AvlTree::Iterator::operator*() const
+{
+	// Return current node's data.
+	return this->path_.back()->getData();
+}
 
-		// If last word wasn't in the left descendant and there're left descendants,
-		// search for lower key among left descendants.
-		else if( tree_traversal.top()->getLeftDescendant() != nullptr &&
-				tree_traversal.top()->getLeftDescendant()->getData()->getWord() != last_word )
-		{
-			tree_traversal.push( tree_traversal.top()->getLeftDescendant() );
-		}
+double AvlTree::Iterator::getKey() const
+{
+	// Return current node's key.
+	return this->path_.back()->getKey();
+}
 
-		// There're no more left descendants:
-		else
+AvlTree::Iterator& AvlTree::Iterator::operator++()
+{
+	// Next word is the first one in the subtree after current node (greater keys, or
+	// lower keys if descending), or else the ascendant on top of the path.
+	AvlTreeNode *node = this->path_.back();
+	this->path_.pop_back();
+	descend( this->descending_ ? node->getLeftDescendant() : node->getRightDescendant() );
+
+	return *this;
+}
+
+AvlTree::Iterator AvlTree::Iterator::operator++( int )
+{
+	// Keep a copy before moving.
+	Iterator previous = *this;
+	++*this;
+
+	return previous;
+}
+
+bool AvlTree::Iterator::operator==( const Iterator &other ) const
+{
+	// Past the end, both of them or neither; otherwise, same node.
+	if( this->path_.empty() || other.path_.empty() )
+		return this->path_.empty() == other.path_.empty();
+
+	return this->path_.back() == other.path_.back();
+}
+
+bool AvlTree::Iterator::operator!=( const Iterator &other ) const
+{
+	// Different word if not the same.
+	return !( *this == other );
+}
+
+void AvlTree::Iterator::descend( AvlTreeNode *node )
+{
+	// Nodes before the range's start are skipped with their subtrees on that side; the
+	// others are pushed on the way to their first descendant.
+	while( node != nullptr )
+	{
+		if( this->descending_ ? node->getKey() <= this->high_ : node->getKey() >= this->low_ )
 		{
-			// This is one of the words with the lowest keys.
-			cout << setw( digits_amount ) << setfill( '0' ) << size
-					<< ". " << tree_traversal.top()->getData()->getWord() << '\n';
-			++size;  // Increment amount of found words.
-			last_word = tree_traversal.top()->getData()->getWord();
-
-			// If last word wasn't in the right descendant and there're right descendants,
-			// search for next lower key among right descendants.
-			if( tree_traversal.top()->getRightDescendant() != nullptr &&
-					tree_traversal.top()->getRightDescendant()->getData()->getWord() != last_word )
-			{
-				printed_words.push( tree_traversal.top()->getData()->getWord() );
-				tree_traversal.push( tree_traversal.top()->getRightDescendant() );
-			}
-			// Left and right descendants have been checked or do not exist, keep backtracking.
-			else
-				tree_traversal.pop();
+			this->path_.push_back( node );
+			node = this->descending_ ? node->getRightDescendant() : node->getLeftDescendant();
 		}
+		else
+			node = this->descending_ ? node->getLeftDescendant() : node->getRightDescendant();
 	}
-}
 
-void AvlTree::setRoot( AvlTreeNode *new_root )
-{
-	// Assign new_root as tree's root.
-		this->root_ = new_root;
+	// Current word past the range's end: so are the others.
+	if( !this->path_.empty() && ( this->descending_ ?
+			this->path_.back()->getKey() < this->low_ : this->path_.back()->getKey() > this->high_ ) )
+		this->path_.clear();
 }
@@ -2,6 +2,16 @@
  * Definitions of AvlTree class - implements an AVL Tree data structure specific for
  * StringHashData score and frequency rankings.
  *
+ * Each node knows the size of its subtree, so a word's rank, the word at a given rank and
+ * the percentile of a key are found along a single path from the root, in O(log n).
+ *
+ * Words in a range of keys are visited by an iterator, in either direction: it seeks the
+ * first word along a single path, in O(log n), keeping that path in a stack, then steps
+ * in O(1) amortized (each node is pushed and popped once).
+ *
+ * Nodes are kept in a pool of slabs owned by the tree: clearing the tree gives them all
+ * back at once, without searching, rebalancing or deallocating each one.
+ *
  *  Created on: July 7th, 2017
  *     Authors: Aline Weber
  *              Renan Kummer
@@ -11,11 +21,102 @@
 #define AVLTREE_H_
 
 // Libraries:
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include <utility>
 #include "AvlTreeNode.h"
+#include "AvlTreeNodePool.h"
+#include "RankingSink.h"
 
 
 class AvlTree {
 public:
+	/**
+	 * Forward iterator over words with keys in a range, in increasing or decreasing order.
+	 * @attention Inserting or removing data invalidates iterators.
+	 */
+	class Iterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = StringHashData*;
+		using difference_type = std::ptrdiff_t;
+		using pointer = StringHashData* const*;
+		using reference = StringHashData*;
+
+		/**
+		 * Constructor: create an iterator past the end of any range.
+		 */
+		Iterator();
+
+		/**
+		 * Get current word.
+		 *  @return Word's satellite data.
+		 */
+		StringHashData* operator*() const;
+
+		/**
+		 * Get current word's key.
+		 *  @return Score or frequency.
+		 */
+		double getKey() const;
+
+		/**
+		 * Move to next word in range.
+		 *  @return This iterator.
+		 */
+		Iterator& operator++();
+
+		/**
+		 * Move to next word in range, returning a copy of this iterator before moving.
+		 *  @return Copy of iterator at current word.
+		 */
+		Iterator operator++( int );
+
+		/**
+		 * Compare positions of two iterators of the same tree.
+		 *  @param other Iterator to compare with.
+		 *  @return True if both point to the same word (or both are past the end), false
+		 *          otherwise.
+		 */
+		bool operator==( const Iterator &other ) const;
+
+		/**
+		 * Compare positions of two iterators of the same tree.
+		 *  @param other Iterator to compare with.
+		 *  @return True if they point to different words, false otherwise.
+		 */
+		bool operator!=( const Iterator &other ) const;
+
+	private:
+		friend class AvlTree;
+
+		/**
+		 * Constructor: seek first word in a range.
+		 *  @param root Tree's root (null pointer if tree is empty).
+		 *  @param low Lowest key in range.
+		 *  @param high Greatest key in range.
+		 *  @param descending Indicate if greatest keys come first.
+		 */
+		Iterator( AvlTreeNode *root, double low, double high, bool descending );
+
+		/**
+		 * Push a subtree's nodes that come before the range's end, down to the first one
+		 * in iteration order, then stop if current word is past the range.
+		 *  @param node Subtree's root.
+		 */
+		void descend( AvlTreeNode *node );
+
+
+	// Attributes:
+		std::vector< AvlTreeNode* > path_;  // Current word's node on top, then ascendants still
+		                                    // to be visited (empty past the end).
+		double low_;                        // Lowest key in range.
+		double high_;                       // Greatest key in range.
+		bool descending_;                   // Indicate if greatest keys come first.
+	};
+
 	/**
 	 * Constructor: initializes AVL tree.
 	 *  @param order Sorting order for this tree's keys.
@@ -41,8 +142,27 @@ public:
 	void remove( StringHashData *data );
 
 	/**
-	 * Clear all data from AVL tree.
-	 *  @attention Sorting order is kept.
+	 * Remove data ranked under a key it may no longer have (e.g. a word's frequency before
+	 * its word was read again), so callers can move data after its key changed.
+	 *  @param data Hash table's satellite data to be removed from AVL tree of rankings.
+	 *  @param key Data's key when it was inserted.
+	 */
+	void remove( StringHashData *data, double key );
+
+	/**
+	 * Replace tree's contents with given data at once: data is sorted by key (ties by word's
+	 * id) with a few threads, then nodes are linked into a balanced tree from the middle of
+	 * each sorted range. Costs O(n log n) for the sort and O(n) for the tree, against
+	 * O(n log n) rotations and comparisons of as many insert() calls.
+	 *  @param data Hash table's satellite data to be ranked (in any order).
+	 *  @attention Previous nodes are released by clear(), so data whose score changed since
+	 *             it was inserted (and may no longer be found) is dropped safely.
+	 */
+	void build( std::vector< StringHashData* > data );
+
+	/**
+	 * Clear all data from AVL tree, giving every node back to the pool at once.
+	 *  @attention Sorting order is kept, and so is the pool's memory (for later insertions).
 	 */
 	void clear();
 
@@ -53,6 +173,14 @@ public:
 	 */
 	bool search( StringHashData *data );
 
+	/**
+	 * Search for data ranked under a given key in AVL tree.
+	 *  @param data Hash table's satellite data to be searched for in AVL tree of rankings.
+	 *  @param key Data's key when it was inserted.
+	 *  @return True if found, false otherwise.
+	 */
+	bool search( StringHashData *data, double key );
+
 	/**
 	 * Check if AVL tree is empty.
 	 *  @return True if is empty, false otherwise.
@@ -71,6 +199,97 @@ public:
 	 */
 	SortBy getKeyOrder();
 
+	/**
+	 * Get amount of data in AVL tree.
+	 *  @return Amount of nodes.
+	 */
+	unsigned getSize();
+
+	/**
+	 * Count data with keys lower than a given key.
+	 *  @param key Score or frequency.
+	 *  @return Amount of data with lower keys.
+	 */
+	unsigned countLowerKeys( double key );
+
+	/**
+	 * Count data with keys greater than a given key.
+	 *  @param key Score or frequency.
+	 *  @return Amount of data with greater keys.
+	 */
+	unsigned countGreaterKeys( double key );
+
+	/**
+	 * Get a word's rank, greatest key first (as printed by printGreatestKeys()). Words with
+	 * equal keys share the same rank, the best among them.
+	 *  @param data Hash table's satellite data to be ranked.
+	 *  @return Rank (1 for the greatest key), 0 if data isn't in the tree.
+	 */
+	unsigned getRank( StringHashData *data );
+
+	/**
+	 * Get word at a given rank, greatest key first.
+	 *  @param rank Position in ranking (1 ~ getSize()).
+	 *  @return Word's satellite data, null pointer if rank is out of range.
+	 */
+	StringHashData* select( unsigned rank );
+
+	/**
+	 * Get percentile of a key: percentage of data with lower keys, plus half of the data
+	 * with equal keys.
+	 *  @param key Score or frequency.
+	 *  @return Percentile (0.0 ~ 100.0), 0.0 if tree is empty.
+	 */
+	double getPercentile( double key );
+
+	/**
+	 * Get words with the greatest keys, in decreasing order of keys, in O(log n + amount).
+	 *  @param amount Amount of words wanted.
+	 *  @param words Vector to be filled with words' satellite data (emptied first).
+	 */
+	void getGreatestKeys( unsigned amount, std::vector< StringHashData* > &words );
+
+	/**
+	 * Get words with the lowest keys, in increasing order of keys, in O(log n + amount).
+	 *  @param amount Amount of words wanted.
+	 *  @param words Vector to be filled with words' satellite data (emptied first).
+	 */
+	void getLowestKeys( unsigned amount, std::vector< StringHashData* > &words );
+
+	/**
+	 * Get iterator to first word with key in a range, in O(log n).
+	 *  @param low Lowest key in range (optional).
+	 *  @param high Greatest key in range (optional).
+	 *  @param descending Indicate if greatest keys come first (optional).
+	 *  @return Iterator to first word, or end() if no key is in range.
+	 */
+	Iterator getRange( double low = -std::numeric_limits< double >::infinity(),
+			double high = std::numeric_limits< double >::infinity(), bool descending = false );
+
+	/**
+	 * Get iterator past the end of any range.
+	 *  @return Iterator past the end.
+	 */
+	Iterator end();
+
+	/**
+	 * Write words with keys in a range to a sink, between its begin() and end().
+	 *  @param sink Destination of words.
+	 *  @param low Lowest key in range.
+	 *  @param high Greatest key in range.
+	 *  @param descending Indicate if greatest keys come first.
+	 *  @param amount Maximum amount of words written (optional).
+	 *  @return Amount of words written.
+	 */
+	unsigned writeRange( RankingSink &sink, double low, double high, bool descending,
+			unsigned amount = std::numeric_limits< unsigned >::max() );
+
+	/**
+	 * Get memory allocated for tree's nodes.
+	 *  @return Bytes allocated by the pool of nodes.
+	 */
+	std::size_t getAllocatedBytes();
+
 	/**
 	 * Print rank_size words with the greatest keys.
 	 *  @param rank_size Amount of words in ranking list.
@@ -90,8 +309,33 @@ private:
 	 */
 	void setRoot( AvlTreeNode *new_root );
 
-	AvlTreeNode *root_; // AVL tree's root.
-	SortBy key_order_;  // Sorting order of keys.
+	/**
+	 * Get data's key in this tree's sorting order.
+	 *  @param data Hash table's satellite data.
+	 *  @return Score or frequency.
+	 */
+	double keyOf( StringHashData *data );
+
+	/**
+	 * Print a ranking list, numbered from 1 with as many digits as rank_size has.
+	 *  @param rank_size Amount of words asked for.
+	 *  @param descending Indicate if greatest keys come first.
+	 */
+	void printRanking( unsigned rank_size, bool descending );
+
+	/**
+	 * Link a balanced tree from a range of sorted keys and data, middle element as root.
+	 *  @param sorted Keys and data, sorted by key.
+	 *  @param first First element of range.
+	 *  @param last Element past the end of range.
+	 *  @return Range's root (null pointer if range is empty).
+	 */
+	AvlTreeNode* buildSubtree( const std::vector< std::pair< double, StringHashData* > > &sorted,
+			unsigned first, unsigned last );
+
+	AvlTreeNode *root_;     // AVL tree's root.
+	SortBy key_order_;      // Sorting order of keys.
+	AvlTreeNodePool pool_;  // Storage of tree's nodes.
 };
 
 #endif /* AVLTREE_H_ */
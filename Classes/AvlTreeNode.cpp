@@ -9,7 +9,9 @@
 // Libraries:
 #include <stack>
 #include <utility>
+#include <functional>
 #include "../Classes/AvlTreeNode.h"
+#include "../Classes/AvlTreeNodePool.h"
 
 
 using namespace std;
@@ -29,9 +31,10 @@ AvlTreeNode::AvlTreeNode()
 
 	this->height_ = 0;  // Initial height.
 	this->factor_ = 0;  // Initial balancing factor.
+	this->size_ = 0;    // Initial size (no data).
 }
 
-AvlTreeNode* AvlTreeNode::insert( StringHashData *data, SortBy key_order )
+AvlTreeNode* AvlTreeNode::insert( StringHashData *data, SortBy key_order, AvlTreeNodePool *pool )
 {
 	// New node's key.
 	double new_key = ( key_order == SortBy::SCORE ) ?
@@ -42,6 +45,7 @@ AvlTreeNode* AvlTreeNode::insert( StringHashData *data, SortBy key_order )
 	{
 		setKey( new_key );  // Root's key.
 		setHeight( 1 );     // Initial height.
+		setSize( 1 );       // Initial size.
 
 		setData( data );    // Node's data.
 
@@ -51,38 +55,40 @@ AvlTreeNode* AvlTreeNode::insert( StringHashData *data, SortBy key_order )
 
 	// Otherwise, search for insertion position:
 
-	// If new node's key is lower than its ascendant's key:
-	else if( new_key < getKey() )
+	// If new node comes before its ascendant (lower key, or equal key and lower id):
+	else if( isLower( new_key, data, getKey(), getData() ) )
 	{
 		// If its ascendant has left descendants, search among them.
 		if( getLeftDescendant() != nullptr )
-			setLeftDescendant( getLeftDescendant()->insert( data, key_order ) );
+			setLeftDescendant( getLeftDescendant()->insert( data, key_order, pool ) );
 		// Otherwise, insert it as left descendant.
 		else
 		{
 			// Node to be inserted as leaf:
-			AvlTreeNode *leaf = new AvlTreeNode;
+			AvlTreeNode *leaf = create( pool );
 			leaf->setKey( new_key );  // Set new node's key.
 			leaf->setHeight( 1 );     // Initial height.
+			leaf->setSize( 1 );       // Initial size.
 			leaf->setData( data );    // Node's data.
 
 			// Set leaf as left descendant.
 			setLeftDescendant( leaf );
 		}
 	}
-	// If new node's key is greater than or equal to its ascendant's key:
+	// If new node comes after its ascendant:
 	else
 	{
 		// If its ascendant has right descendants, search among them.
 		if( getRightDescendant() != nullptr )
-			setRightDescendant( getRightDescendant()->insert( data, key_order ) );
+			setRightDescendant( getRightDescendant()->insert( data, key_order, pool ) );
 		// Otherwise, insert it as right descendant.
 		else
 		{
 			// Node to be inserted as leaf:
-			AvlTreeNode *leaf = new AvlTreeNode;
+			AvlTreeNode *leaf = create( pool );
 			leaf->setKey( new_key );  // Set new node's key.
 			leaf->setHeight( 1 );     // Initial height.
+			leaf->setSize( 1 );       // Initial size.
 			leaf->setData( data );    // Node's data.
 
 			// Set leaf as right descendant.
@@ -92,8 +98,9 @@ AvlTreeNode* AvlTreeNode::insert( StringHashData *data, SortBy key_order )
 
 	// Backtrack through traversed tree maintaining balancing factor of -1, 0 or 1.
 
-	// Update node's height and balancing factor.
+	// Update node's height, size and balancing factor.
 	updateHeight();
+	updateSize();
 	updateFactor();
 
 	AvlTreeNode *root = this;
@@ -105,12 +112,18 @@ AvlTreeNode* AvlTreeNode::insert( StringHashData *data, SortBy key_order )
 	return root;
 }
 
-AvlTreeNode* AvlTreeNode::remove( StringHashData *data, SortBy key_order )
+AvlTreeNode* AvlTreeNode::remove( StringHashData *data, SortBy key_order, AvlTreeNodePool *pool )
 {
 	// Key of node to be removed.
 	double remove_key = ( key_order == SortBy::SCORE ) ?
 			data->getScore() : static_cast< double >( data->getFrequency() );
 
+	// Remove data ranked under its current key.
+	return remove( remove_key, data, pool );
+}
+
+AvlTreeNode* AvlTreeNode::remove( double remove_key, StringHashData *data, AvlTreeNodePool *pool )
+{
 	// If tree is empty:
 	if( getKey() == -1.0 )
 	{
@@ -132,11 +145,13 @@ AvlTreeNode* AvlTreeNode::remove( StringHashData *data, SortBy key_order )
 			setKey( greatest->getKey() );    // Node's new key. This removes node's old key.
 			setData( greatest->getData() );  // Node's new data. This removes node's old data.
 
-			// Remove node with greatest key among left descendants while linking modified nodes.
-			setLeftDescendant( getLeftDescendant()->remove( greatest->getData(), key_order ) );
+			// Remove node with greatest key among left descendants while linking modified nodes
+			// (by its key in the tree, in case its data's key changed since).
+			setLeftDescendant( getLeftDescendant()->remove( getKey(), getData(), pool ) );
 
-			// Update node's height and balancing factor.
+			// Update node's height, size and balancing factor.
 			updateHeight();
+			updateSize();
 			updateFactor();
 
 			// Tree's root up to this point.
@@ -156,7 +171,7 @@ AvlTreeNode* AvlTreeNode::remove( StringHashData *data, SortBy key_order )
 			AvlTreeNode *new_root = getLeftDescendant();
 
 			// Deallocate memory used for node to be removed.
-			delete this;
+			destroy( pool );
 
 			// Return tree's new root.
 			return new_root;
@@ -169,7 +184,7 @@ AvlTreeNode* AvlTreeNode::remove( StringHashData *data, SortBy key_order )
 			AvlTreeNode *new_root = getRightDescendant();
 
 			// Deallocate memory used for node to be removed.
-			delete this;
+			destroy( pool );
 
 			// Return tree's new root.
 			return new_root;
@@ -179,28 +194,23 @@ AvlTreeNode* AvlTreeNode::remove( StringHashData *data, SortBy key_order )
 		else
 		{
 			// Deallocate memory used for node to be removed.
-			delete this;
+			destroy( pool );
 
 			// Return null pointer (empty node).
 			return nullptr;
 		}
 	}
 
-	// If remove_key is lower than current node, search among left descendants.
-	else if( getLeftDescendant() != nullptr && remove_key < getKey() )
-		setLeftDescendant( getLeftDescendant()->remove( data, key_order ) );
-	// If remove_key is greater than current node, search among right descendants.
-	else if( getRightDescendant() != nullptr && remove_key > getKey() )
-		setRightDescendant( getRightDescendant()->remove( data, key_order ) );
-	// If remove_key is equal to current node, search among existing descendants.
-	else if( ( getLeftDescendant() != nullptr || getRightDescendant() != nullptr ) &&
-				remove_key == getKey() )
+	// If data comes before current node, search among left descendants.
+	else if( isLower( remove_key, data, getKey(), getData() ) )
 	{
-		if( getLeftDescendant() != nullptr )
-			setLeftDescendant( getLeftDescendant()->remove( data, key_order ) );
-		if( getRightDescendant() != nullptr )
-			setRightDescendant( getRightDescendant()->remove( data, key_order ) );
+		if( getLeftDescendant() == nullptr )
+			return this;  // Data isn't in the tree.
+		setLeftDescendant( getLeftDescendant()->remove( remove_key, data, pool ) );
 	}
+	// If data comes after current node, search among right descendants.
+	else if( getRightDescendant() != nullptr )
+		setRightDescendant( getRightDescendant()->remove( remove_key, data, pool ) );
 	// Otherwise, there are no descendants to search and remove_key isn't in the tree.
 	else
 	{
@@ -208,8 +218,9 @@ AvlTreeNode* AvlTreeNode::remove( StringHashData *data, SortBy key_order )
 		return this;
 	}
 
-	// Update this node's height and balancing factor.
+	// Update this node's height, size and balancing factor.
 	updateHeight();
+	updateSize();
 	updateFactor();
 
 	// Tree's root up to this point.
@@ -224,14 +235,20 @@ AvlTreeNode* AvlTreeNode::remove( StringHashData *data, SortBy key_order )
 
 bool AvlTreeNode::search( StringHashData *data, SortBy key_order )
 {
-	// If tree is empty, return FALSE (not found).
-	if( getKey() < 0.0 )
-		return false;
-
 	// Key of node to be found
 	double find_key = ( key_order == SortBy::SCORE ) ?
 			data->getScore() : static_cast< double >( data->getFrequency() );
 
+	// Search for data ranked under its current key.
+	return search( find_key, data );
+}
+
+bool AvlTreeNode::search( double find_key, StringHashData *data )
+{
+	// If tree is empty, return FALSE (not found).
+	if( getKey() < 0.0 )
+		return false;
+
 	// Pointer to traverse AVL tree.
 	AvlTreeNode *current_node = this;
 	// Search for node with find_key.
@@ -240,34 +257,49 @@ bool AvlTreeNode::search( StringHashData *data, SortBy key_order )
 		// If find_key has been found, return TRUE.
 		if( current_node->getKey() == find_key && current_node->getData() == data )
 			return true;
-		// If find_key is lower than current_node's key, search among left descendants.
-		else if( find_key < current_node->getKey() )
+		// If data comes before current_node, search among left descendants.
+		else if( isLower( find_key, data, current_node->getKey(), current_node->getData() ) )
 			current_node = current_node->getLeftDescendant();
-		// If find_key is greater than current_node's key, search among right descendants.
-		else if( find_key > current_node->getKey() )
-			current_node = current_node->getRightDescendant();
-		// If find_key is equal to current_node's key, but has different data, search among
-		// existing descendants.
+		// Otherwise, search among right descendants.
 		else
-		{
-			// Search among left descendants.
-			if( current_node->getLeftDescendant() != nullptr &&
-					current_node->getLeftDescendant()->search( data, key_order ) )
-				return true;
-			// Search among right descendants if data wasn't found in left descendants.
-			else if( current_node->getRightDescendant() != nullptr &&
-					current_node->getRightDescendant()->search( data, key_order ) )
-				return true;
-			// Node wasn't found in the tree.
-			else
-				return false;
-		}
+			current_node = current_node->getRightDescendant();
 	}
 
 	// Since find_key wasn't found, return FALSE.
 	return false;
 }
 
+bool AvlTreeNode::isLower( double key, StringHashData *data, double other_key, StringHashData *other_data )
+{
+	// Keys decide, if they differ.
+	if( key != other_key )
+		return key < other_key;
+
+	// Equal keys: words' ids decide, if they differ.
+	uint32_t id = data->getWordId();
+	uint32_t other_id = other_data->getWordId();
+	if( id != other_id )
+		return id < other_id;
+
+	// Same id (no word): addresses decide.
+	return less< StringHashData* >()( data, other_data );
+}
+
+AvlTreeNode* AvlTreeNode::create( AvlTreeNodePool *pool )
+{
+	// Take node from pool, if there's one.
+	return ( pool != nullptr ) ? pool->allocate() : new AvlTreeNode;
+}
+
+void AvlTreeNode::destroy( AvlTreeNodePool *pool )
+{
+	// Give node back to its pool, if there's one.
+	if( pool != nullptr )
+		pool->release( this );
+	else
+		delete this;
+}
+
 bool AvlTreeNode::setKey( double key )
 {
 	// If key is valid (non-negative):
@@ -359,6 +391,18 @@ int AvlTreeNode::getHeight()
 	return this->height_;
 }
 
+void AvlTreeNode::setSize( unsigned size )
+{
+	// Assign size argument to subtree's size.
+	this->size_ = size;
+}
+
+unsigned AvlTreeNode::getSize()
+{
+	// Return subtree's size.
+	return this->size_;
+}
+
 void AvlTreeNode::setFactor( int factor )
 {
 	// Assign factor argument to node's balancing factor.
@@ -398,6 +442,18 @@ void AvlTreeNode::updateHeight()
 		setHeight( 1 );
 }
 
+void AvlTreeNode::updateSize()
+{
+	// This node plus nodes of each existing descendant.
+	unsigned size = 1;
+	if( getLeftDescendant() != nullptr )
+		size += getLeftDescendant()->getSize();
+	if( getRightDescendant() != nullptr )
+		size += getRightDescendant()->getSize();
+
+	setSize( size );
+}
+
 void AvlTreeNode::updateFactor()
 {
 	// Left descendant node.
@@ -476,8 +532,9 @@ AvlTreeNode* AvlTreeNode::rotate()
 		root = rotateRight();
 	}
 
-	// Update root's height and balancing factor.
+	// Update root's height, size and balancing factor.
 	root->updateHeight();
+	root->updateSize();
 	root->updateFactor();
 
 	// Return tree root.
@@ -496,8 +553,9 @@ AvlTreeNode* AvlTreeNode::rotateLeft()
 	setRightDescendant( new_root->getLeftDescendant() );
 	new_root->setLeftDescendant( old_root );
 
-	// Updates modified node's height and balancing factor.
+	// Updates modified node's height, size and balancing factor.
 	updateHeight();
+	updateSize();
 	updateFactor();
 
 	// Return tree's new root.
@@ -516,8 +574,9 @@ AvlTreeNode* AvlTreeNode::rotateRight()
 	setLeftDescendant( new_root->getRightDescendant() );
 	new_root->setRightDescendant( old_root );
 
-	// Updates modified node's height and balancing factor.
+	// Updates modified node's height, size and balancing factor.
 	updateHeight();
+	updateSize();
 	updateFactor();
 
 	// Return tree's new root.
@@ -19,6 +19,9 @@
  */
 enum SortBy { SCORE, FREQUENCY };
 
+// Storage for nodes (optional; nodes are allocated one by one without it).
+class AvlTreeNodePool;
+
 
 class AvlTreeNode {
 public:
@@ -30,16 +33,29 @@ public:
 	/**
 	 * Insert data into the AVL tree, returning pointer to tree's root.
 	 *  @param data Hash table's satellite data to be inserted in AVL tree of rankings.
+	 *  @param pool Storage of tree's nodes (optional; new nodes are allocated with new
+	 *              without it).
 	 *  @return Pointer to AVL tree's root.
 	 */
-	AvlTreeNode* insert( StringHashData *data, SortBy key_order );
+	AvlTreeNode* insert( StringHashData *data, SortBy key_order, AvlTreeNodePool *pool = nullptr );
 
 	/**
 	 * Remove data from AVL tree, returning pointer to tree's root.
 	 *  @param data Hash table's satellite data to be removed from AVL tree of rankings.
+	 *  @param pool Storage of tree's nodes (optional; removed node is deleted without it).
+	 *  @return Pointer to AVL tree's root.
+	 */
+	AvlTreeNode* remove( StringHashData *data, SortBy key_order, AvlTreeNodePool *pool = nullptr );
+
+	/**
+	 * Remove data ranked under a given key, returning pointer to tree's root.
+	 *  @param key Data's key in the tree (which may differ from its current score or
+	 *             frequency, if it changed since data was inserted).
+	 *  @param data Hash table's satellite data to be removed from AVL tree of rankings.
+	 *  @param pool Storage of tree's nodes (optional; removed node is deleted without it).
 	 *  @return Pointer to AVL tree's root.
 	 */
-	AvlTreeNode* remove( StringHashData *data, SortBy key_order );
+	AvlTreeNode* remove( double key, StringHashData *data, AvlTreeNodePool *pool = nullptr );
 
 	/**
 	 * Search for a given node in AVL tree of rankings.
@@ -48,6 +64,26 @@ public:
 	 */
 	bool search( StringHashData *data, SortBy key_order );
 
+	/**
+	 * Search for data ranked under a given key in AVL tree of rankings.
+	 *  @param key Data's key in the tree.
+	 *  @param data Hash table's satellite data to be searched for in AVL tree of rankings.
+	 *  @return True if found, false otherwise.
+	 */
+	bool search( double key, StringHashData *data );
+
+	/**
+	 * Compare two data in trees' order: by key, equal keys by word's id, and data without
+	 * ids (StringHashData::NO_WORD) by address. Every data has its own place, so searches
+	 * and removals follow a single path even when many words share a key.
+	 *  @param key Data's key.
+	 *  @param data Hash table's satellite data.
+	 *  @param other_key Other data's key.
+	 *  @param other_data Other hash table's satellite data.
+	 *  @return True if data comes before other data (lower), false otherwise.
+	 */
+	static bool isLower( double key, StringHashData *data, double other_key, StringHashData *other_data );
+
 	/**
 	 * Set node's key.
 	 *  @param key Node's key.
@@ -116,6 +152,18 @@ public:
 	 */
 	int getHeight();
 
+	/**
+	 * Set amount of nodes in the subtree rooted at this node.
+	 *  @param size Subtree's amount of nodes (this one included).
+	 */
+	void setSize( unsigned size );
+
+	/**
+	 * Get amount of nodes in the subtree rooted at this node.
+	 *  @return Subtree's amount of nodes (this one included).
+	 */
+	unsigned getSize();
+
 	/**
 	 * Set node's balancing factor.
 	 *  @param factor Node's balancing factor.
@@ -129,11 +177,29 @@ public:
 	int getFactor();
 
 private:
+	/**
+	 * Allocate a new node.
+	 *  @param pool Storage of tree's nodes (new is used if it's a null pointer).
+	 *  @return New node.
+	 */
+	static AvlTreeNode* create( AvlTreeNodePool *pool );
+
+	/**
+	 * Deallocate this node.
+	 *  @param pool Storage of tree's nodes (delete is used if it's a null pointer).
+	 */
+	void destroy( AvlTreeNodePool *pool );
+
 	/**
 	 * Update node's height (greatest height between descendants plus one).
 	 */
 	void updateHeight();
 
+	/**
+	 * Update subtree's size (sum of descendants' sizes plus one).
+	 */
+	void updateSize();
+
 	/**
 	 * Update node's factor (difference between descendants's heights).
 	 */
@@ -173,6 +239,7 @@ private:
 
 	int height_;  // Node's height.
 	int factor_;  // Node's balancing factor.
+	unsigned size_;  // Amount of nodes in subtree rooted at this node (for rank and select).
 
 };
 
@@ -0,0 +1,91 @@
+/**
+ * Class AvlTreeNodePool member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include "AvlTreeNodePool.h"
+
+using namespace std;
+
+
+AvlTreeNodePool::AvlTreeNodePool( std::size_t slab_size )
+{
+	// At least one node per slab.
+	this->slab_size_ = slab_size == 0 ? 1 : slab_size;
+
+	// No slab allocated yet, no node released.
+	this->free_nodes_ = nullptr;
+	this->slab_ = 0;
+	this->next_ = 0;
+	this->used_ = 0;
+}
+
+AvlTreeNode* AvlTreeNodePool::allocate()
+{
+	// Node to be given.
+	AvlTreeNode *node;
+
+	// Reuse last released node, if any.
+	if( this->free_nodes_ != nullptr )
+	{
+		node = this->free_nodes_;
+		this->free_nodes_ = node->getLeftDescendant();
+	}
+	else
+	{
+		// If current slab is full, move to the next one, allocating it if needed.
+		if( this->slab_ < this->slabs_.size() && this->next_ == this->slab_size_ )
+		{
+			++this->slab_;
+			this->next_ = 0;
+		}
+		if( this->slab_ == this->slabs_.size() )
+		{
+			this->slabs_.emplace_back( new AvlTreeNode[ this->slab_size_ ] );
+			this->next_ = 0;
+		}
+
+		// Node is the first free position of current slab.
+		node = &this->slabs_[ this->slab_ ][ this->next_ ];
+		++this->next_;
+	}
+
+	// Node starts as a new one.
+	*node = AvlTreeNode();
+	++this->used_;
+
+	return node;
+}
+
+void AvlTreeNodePool::release( AvlTreeNode *node )
+{
+	// Put node at the front of released nodes.
+	node->setLeftDescendant( this->free_nodes_ );
+	this->free_nodes_ = node;
+	--this->used_;
+}
+
+void AvlTreeNodePool::releaseAll()
+{
+	// Forget released nodes and rewind to the first slab's first position.
+	this->free_nodes_ = nullptr;
+	this->slab_ = 0;
+	this->next_ = 0;
+	this->used_ = 0;
+}
+
+std::size_t AvlTreeNodePool::getUsedAmount() const
+{
+	// Return nodes in use.
+	return this->used_;
+}
+
+std::size_t AvlTreeNodePool::getAllocatedBytes() const
+{
+	// Return bytes of every slab.
+	return this->slabs_.size() * this->slab_size_ * sizeof( AvlTreeNode );
+}
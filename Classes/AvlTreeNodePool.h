@@ -0,0 +1,72 @@
+/**
+ * Definitions of AvlTreeNodePool class - storage for the nodes of an AVL tree, allocated
+ * in slabs of many nodes at once.
+ *
+ * A node costs no allocation of its own: it's taken from a list of released nodes, or
+ * from the next free position of the last slab. Released nodes are linked through their
+ * left descendant pointer, so the list needs no memory either. Releasing every node at
+ * once only rewinds the slabs, which are kept for the next nodes.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef AVLTREENODEPOOL_H_
+#define AVLTREENODEPOOL_H_
+
+// Libraries:
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "AvlTreeNode.h"
+
+
+class AvlTreeNodePool {
+public:
+	/**
+	 * Constructor: create an empty pool.
+	 *  @param slab_size Nodes allocated at once.
+	 */
+	AvlTreeNodePool( std::size_t slab_size = 1024 );
+
+	/**
+	 * Get a node, initialized as by AvlTreeNode's constructor.
+	 *  @return Node, valid until it's released.
+	 */
+	AvlTreeNode* allocate();
+
+	/**
+	 * Give a node back to the pool, to be reused by a later allocate().
+	 *  @param node Node taken from this pool.
+	 */
+	void release( AvlTreeNode *node );
+
+	/**
+	 * Give every node back to the pool at once (nodes aren't visited; slabs are kept).
+	 */
+	void releaseAll();
+
+	/**
+	 * Get amount of nodes in use.
+	 *  @return Nodes allocated and not released.
+	 */
+	std::size_t getUsedAmount() const;
+
+	/**
+	 * Get amount of memory allocated for slabs.
+	 *  @return Bytes allocated.
+	 */
+	std::size_t getAllocatedBytes() const;
+
+private:
+// Attributes:
+	std::vector< std::unique_ptr< AvlTreeNode[] > > slabs_;  // Slabs of nodes.
+	AvlTreeNode *free_nodes_;  // Released nodes, linked by left descendant.
+	std::size_t slab_size_;    // Nodes per slab.
+	std::size_t slab_;         // Slab with free positions (slabs_.size() if none).
+	std::size_t next_;         // First free position of that slab.
+	std::size_t used_;         // Nodes in use.
+};
+
+#endif /* AVLTREENODEPOOL_H_ */
@@ -0,0 +1,90 @@
+/**
+ * Class CardinalityEstimator member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <cmath>
+#include <algorithm>
+#include "CardinalityEstimator.h"
+
+using namespace std;
+
+
+CardinalityEstimator::CardinalityEstimator( unsigned precision )
+{
+	// Keep precision in a useful range (16 ~ 262,144 registers).
+	this->precision_ = min( max( precision, 4u ), 18u );
+
+	// All registers start at zero.
+	this->registers_.assign( 1u << this->precision_, 0 );
+}
+
+void CardinalityEstimator::add( uint64_t hash_value )
+{
+	// Spread hash value's bits.
+	uint64_t bits = mix( hash_value );
+
+	// Upper bits select a register.
+	unsigned index = bits >> ( 64 - this->precision_ );
+
+	// Position of first set bit in the remaining ones (all of them zero counts as the longest run).
+	uint64_t remaining = bits << this->precision_;
+	uint8_t rank = remaining == 0 ? 64 - this->precision_ + 1 : __builtin_clzll( remaining ) + 1;
+
+	// Keep longest run.
+	if( rank > this->registers_[ index ] )
+		this->registers_[ index ] = rank;
+}
+
+double CardinalityEstimator::estimate() const
+{
+	// Amount of registers.
+	double m = this->registers_.size();
+
+	// Harmonic mean of 2^register and registers still at zero.
+	double sum = 0.0;
+	unsigned zeros = 0;
+	for( auto rank : this->registers_ )
+	{
+		sum += ldexp( 1.0, -rank );
+		if( rank == 0 )
+			++zeros;
+	}
+
+	// Raw HyperLogLog estimate, with bias correction for this amount of registers.
+	double alpha = 0.7213 / ( 1.0 + 1.079 / m );
+	double estimate = alpha * m * m / sum;
+
+	// Few words: count registers still at zero instead (linear counting), which is more
+	// accurate there.
+	if( estimate <= 2.5 * m && zeros != 0 )
+		estimate = m * log( m / zeros );
+
+	return estimate;
+}
+
+void CardinalityEstimator::clear()
+{
+	// Set every register back to zero.
+	fill( this->registers_.begin(), this->registers_.end(), 0 );
+}
+
+unsigned CardinalityEstimator::getPrecision() const
+{
+	// Return amount of bits selecting a register.
+	return this->precision_;
+}
+
+uint64_t CardinalityEstimator::mix( uint64_t hash_value )
+{
+	// SplitMix64's finalizer: every input bit affects every output bit.
+	hash_value += 0x9E3779B97F4A7C15ULL;
+	hash_value = ( hash_value ^ ( hash_value >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+	hash_value = ( hash_value ^ ( hash_value >> 27 ) ) * 0x94D049BB133111EBULL;
+
+	return hash_value ^ ( hash_value >> 31 );
+}
@@ -0,0 +1,147 @@
+/**
+ * Class ConcurrentStringHashTable member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include "ConcurrentStringHashTable.h"
+
+using namespace std;
+
+
+ConcurrentStringHashTable::ConcurrentStringHashTable( unsigned size, unsigned shards,
+		HashPolicy policy, uint64_t seed )
+	: hasher_( policy, seed )  // Select hashing function.
+{
+	// At least one shard is needed.
+	if( shards == 0 )
+		shards = 1;
+
+	// Create shards, splitting size among them.
+	for( unsigned i = 0; i < shards; ++i )
+		this->shards_.emplace_back( ( size + shards - 1 ) / shards, policy, seed );
+}
+
+bool ConcurrentStringHashTable::insert( std::string_view word, double phrase_score, unsigned index,
+		unsigned *key )
+{
+	// Hash word outside any lock.
+	return insert( word, hashOf( word ), phrase_score, index, key );
+}
+
+bool ConcurrentStringHashTable::insert( std::string_view word, uint64_t hash_value,
+		double phrase_score, unsigned index, unsigned *key )
+{
+	// Shard of word.
+	unsigned shard = shardOf( hash_value );
+	Shard &s = this->shards_[ shard ];
+
+	// Indicate word was inserted.
+	bool is_inserted;
+	// Word's key in the shard.
+	unsigned shard_key;
+
+	{
+		lock_guard< mutex > lock( s.mutex );
+
+		shard_key = s.table.findOrInsert( word, hash_value, phrase_score, index, &is_inserted );
+
+		// Word already known: update its score and frequency while still holding the lock.
+		if( !is_inserted )
+			s.table.getData( shard_key )->recalculateScore( phrase_score, index );
+	}
+
+	// If requested, return key to this word as well (shard's key interleaved with shard).
+	if( key != nullptr )
+		*key = shard_key * getShardsAmount() + shard;
+
+	return is_inserted;
+}
+
+bool ConcurrentStringHashTable::search( std::string_view word, unsigned *key )
+{
+	// Hash word outside any lock.
+	return search( word, hashOf( word ), key );
+}
+
+bool ConcurrentStringHashTable::search( std::string_view word, uint64_t hash_value, unsigned *key )
+{
+	// Shard of word.
+	unsigned shard = shardOf( hash_value );
+	Shard &s = this->shards_[ shard ];
+
+	// Indicate word was found.
+	bool is_found;
+	// Word's key in the shard.
+	unsigned shard_key;
+
+	{
+		// Searching may move groups of a table being rehashed, so the lock is exclusive.
+		lock_guard< mutex > lock( s.mutex );
+		is_found = s.table.search( word, hash_value, &shard_key );
+	}
+
+	// If requested, return key to this word as well.
+	if( is_found && key != nullptr )
+		*key = shard_key * getShardsAmount() + shard;
+
+	return is_found;
+}
+
+uint64_t ConcurrentStringHashTable::hashOf( std::string_view word ) const
+{
+	// Return hash value.
+	return this->hasher_.hash( word );
+}
+
+void ConcurrentStringHashTable::remove( std::string_view word )
+{
+	// Shard of word.
+	Shard &s = this->shards_[ shardOf( hashOf( word ) ) ];
+
+	lock_guard< mutex > lock( s.mutex );
+	s.table.remove( word );
+}
+
+StringHashData* ConcurrentStringHashTable::getData( unsigned key )
+{
+	// Split key into shard and shard's key.
+	return this->shards_[ key % getShardsAmount() ].table.getData( key / getShardsAmount() );
+}
+
+unsigned ConcurrentStringHashTable::getUsedAmount()
+{
+	// Amount of data stored.
+	unsigned amount = 0;
+
+	// Add amount stored in each shard.
+	for( auto &s : this->shards_ )
+	{
+		lock_guard< mutex > lock( s.mutex );
+		amount += s.table.getUsedAmount();
+	}
+
+	return amount;
+}
+
+unsigned ConcurrentStringHashTable::getShardsAmount() const
+{
+	// Return amount of shards.
+	return this->shards_.size();
+}
+
+StringHashTable& ConcurrentStringHashTable::getShard( unsigned shard )
+{
+	// Return shard's hash table.
+	return this->shards_[ shard ].table;
+}
+
+unsigned ConcurrentStringHashTable::shardOf( uint64_t hash_value ) const
+{
+	// Groups inside a shard's table are chosen modulo a prime, so they don't depend on
+	// the same bits as the shard.
+	return hash_value % getShardsAmount();
+}
@@ -0,0 +1,147 @@
+/**
+ * Definitions of ConcurrentStringHashTable class - a hash table for strings that many
+ * threads may use at the same time.
+ *
+ * Words are split into shards by hash value. Each shard is a StringHashTable guarded by
+ * its own mutex, so threads only wait for each other when their words fall in the same
+ * shard. A word is hashed once, outside any lock, and the hash value chooses the shard
+ * and is reused by the shard's table.
+ *
+ * Shards are locked rather than updated lock-free: each shard's table owns its slots, its
+ * satellite data (a deque of StringHashData) and its arena of characters, all of which
+ * grow as words are inserted and are moved by incremental rehashing, and counting a known
+ * word updates several fields of its satellite data (histogram, frequency, reviews) that
+ * must change together.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef CONCURRENTSTRINGHASHTABLE_H_
+#define CONCURRENTSTRINGHASHTABLE_H_
+
+// Libraries:
+#include <string_view>
+#include <deque>
+#include <mutex>
+#include <cstdint>
+#include "StringHashTable.h"
+
+
+class ConcurrentStringHashTable {
+public:
+	/**
+	 * Constructor: create hash table with given size split in shards.
+	 *  @param size Hash table's initial size (shared by all shards).
+	 *  @param shards Amount of shards, each with its own lock.
+	 *  @param policy Hashing function to be used (seeded 64-bit by default).
+	 *  @param seed Seed for the hashing function.
+	 */
+	ConcurrentStringHashTable( unsigned size, unsigned shards = 16,
+			HashPolicy policy = HashPolicy::SEEDED, uint64_t seed = 0 );
+
+	/**
+	 * Insert string in hash table at given index or, if it's already there, update its
+	 * score and frequency with phrase_score. Safe to call from many threads.
+	 *  @param word Word to be inserted.
+	 *  @param phrase_score Word's score in the phrase.
+	 *  @param index Phrase's index.
+	 *  @param key Word's key in the hash table (optional).
+	 *  @return True if inserted, false if it was updated.
+	 */
+	bool insert( std::string_view word, double phrase_score, unsigned index, unsigned *key = nullptr );
+
+	/**
+	 * Insert or update string using a hash value calculated by hashOf() beforehand.
+	 *  @param word Word to be inserted.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param phrase_score Word's score in the phrase.
+	 *  @param index Phrase's index.
+	 *  @param key Word's key in the hash table (optional).
+	 *  @return True if inserted, false if it was updated.
+	 */
+	bool insert( std::string_view word, uint64_t hash_value, double phrase_score, unsigned index,
+			unsigned *key = nullptr );
+
+	/**
+	 * Search for given string in hash table. Safe to call from many threads.
+	 *  @param word Word to find.
+	 *  @param key Word's key in the hash table if found (optional).
+	 *  @return True if found, false otherwise.
+	 */
+	bool search( std::string_view word, unsigned *key = nullptr );
+
+	/**
+	 * Search for given string using a hash value calculated by hashOf() beforehand.
+	 *  @param word Word to find.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param key Word's key in the hash table if found (optional).
+	 *  @return True if found, false otherwise.
+	 */
+	bool search( std::string_view word, uint64_t hash_value, unsigned *key = nullptr );
+
+	/**
+	 * Calculate a word's 64-bit hash value with this table's hashing function. Needs no lock.
+	 *  @param word Word to be hashed.
+	 *  @return Hash value.
+	 */
+	uint64_t hashOf( std::string_view word ) const;
+
+	/**
+	 * Remove string from hash table. Safe to call from many threads.
+	 *  @param word Word to be removed.
+	 */
+	void remove( std::string_view word );
+
+	/**
+	 * Get satellite data with given key.
+	 *  @param key Word's key.
+	 *  @return Pointer to satellite data (stable for as long as the table exists).
+	 *  @attention Data isn't locked: read it only once every thread stopped inserting.
+	 */
+	StringHashData* getData( unsigned key );
+
+	/**
+	 * Get amount of data stored in all shards.
+	 *  @return Amount of data stored.
+	 */
+	unsigned getUsedAmount();
+
+	/**
+	 * Get amount of shards.
+	 *  @return Amount of shards.
+	 */
+	unsigned getShardsAmount() const;
+
+	/**
+	 * Get shard's hash table, e.g. to read its statistics.
+	 *  @param shard Shard's index.
+	 *  @return Shard's hash table.
+	 *  @attention Table isn't locked: use it only once every thread stopped inserting.
+	 */
+	StringHashTable& getShard( unsigned shard );
+
+private:
+	/**
+	 * Calculate shard of a hash value.
+	 *  @param hash_value Word's hash value.
+	 *  @return Shard's index.
+	 */
+	unsigned shardOf( uint64_t hash_value ) const;
+
+
+	// Hash table and the lock that guards it.
+	struct Shard {
+		Shard( unsigned size, HashPolicy policy, uint64_t seed ) : table( size, policy, seed ) {}
+
+		std::mutex mutex;       // Guards table and its satellite data.
+		StringHashTable table;  // Words whose hash value falls in this shard.
+	};
+
+// Attributes:
+	StringHasher hasher_;          // Hashing function (same as every shard's).
+	std::deque< Shard > shards_;   // Shards (mutexes can't be moved, so a deque holds them).
+};
+
+#endif /* CONCURRENTSTRINGHASHTABLE_H_ */
@@ -0,0 +1,239 @@
+/**
+ * Class FrozenRanking member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <iostream>
+#include <algorithm>
+#include <utility>
+#include "FrozenRanking.h"
+#include "ParallelSort.h"
+
+using namespace std;
+
+
+FrozenRanking::FrozenRanking( SortBy order )
+{
+	// Set sorting order of keys; ranking starts empty.
+	this->key_order_ = order;
+}
+
+void FrozenRanking::build( std::vector< StringHashData* > data )
+{
+	// Key of each data, calculated only once (scores are derived from histograms).
+	vector< pair< double, StringHashData* > > sorted;
+	sorted.reserve( data.size() );
+	for( auto d : data )
+		sorted.emplace_back( keyOf( d ), d );
+
+	// Order as AvlTree does: by key, ties by word's id (data without ids by address).
+	parallelSort( sorted, []( const pair< double, StringHashData* > &a, const pair< double, StringHashData* > &b )
+	{
+		return AvlTreeNode::isLower( a.first, a.second, b.first, b.second );
+	} );
+
+	// Split sorted pairs in arrays of keys and data.
+	clear();
+	this->keys_.reserve( sorted.size() );
+	this->data_.reserve( sorted.size() );
+	for( auto &element : sorted )
+	{
+		this->keys_.push_back( element.first );
+		this->data_.push_back( element.second );
+	}
+
+	// Copy keys in Eytzinger order (position 0 is unused, root is at 1).
+	this->eytzinger_.resize( sorted.size() + 1 );
+	this->positions_.resize( sorted.size() + 1 );
+	layout( 1, 0 );
+}
+
+void FrozenRanking::clear()
+{
+	// Release every array.
+	vector< double >().swap( this->keys_ );
+	vector< StringHashData* >().swap( this->data_ );
+	vector< double >().swap( this->eytzinger_ );
+	vector< unsigned >().swap( this->positions_ );
+}
+
+bool FrozenRanking::isEmpty() const
+{
+	// Return whether there are no keys.
+	return this->keys_.empty();
+}
+
+SortBy FrozenRanking::getKeyOrder() const
+{
+	// Return sorting order.
+	return this->key_order_;
+}
+
+unsigned FrozenRanking::getSize() const
+{
+	// Return amount of keys.
+	return this->keys_.size();
+}
+
+unsigned FrozenRanking::countLowerKeys( double key ) const
+{
+	// Lower keys come before the first key not lower than key.
+	return lowerBound( key, true );
+}
+
+unsigned FrozenRanking::countGreaterKeys( double key ) const
+{
+	// Greater keys come after the last key not greater than key.
+	return getSize() - lowerBound( key, false );
+}
+
+unsigned FrozenRanking::getRank( StringHashData *data ) const
+{
+	// Range of keys equal to data's key.
+	double key = keyOf( data );
+	unsigned first = lowerBound( key, true );
+	unsigned last = lowerBound( key, false );
+
+	// Equal keys follow AvlTreeNode::isLower (by word's id): find data among those with its id.
+	auto i = lower_bound( this->data_.begin() + first, this->data_.begin() + last, data->getWordId(),
+			[]( StringHashData *d, uint32_t id ) { return d->getWordId() < id; } );
+	for( ; i != this->data_.begin() + last && ( *i )->getWordId() == data->getWordId(); ++i )
+		if( *i == data )
+			return getSize() - last + 1;  // Rank follows every greater key.
+
+	// Data isn't ranked (or its key changed since ranking was built).
+	return 0;
+}
+
+StringHashData* FrozenRanking::select( unsigned rank ) const
+{
+	// Rank out of range has no word.
+	if( rank == 0 || rank > getSize() )
+		return nullptr;
+
+	// Greatest key is the last one.
+	return this->data_[ getSize() - rank ];
+}
+
+double FrozenRanking::getPercentile( double key ) const
+{
+	// Empty ranking has no percentiles.
+	if( isEmpty() )
+		return 0.0;
+
+	// Lower keys, and equal keys (neither lower nor greater).
+	unsigned lower = countLowerKeys( key );
+	unsigned equal = getSize() - lower - countGreaterKeys( key );
+
+	return 100.0 * ( lower + equal / 2.0 ) / getSize();
+}
+
+void FrozenRanking::getGreatestKeys( unsigned amount, std::vector< StringHashData* > &words ) const
+{
+	// Last amount words, backwards.
+	words.assign( this->data_.rbegin(), this->data_.rbegin() + min( amount, getSize() ) );
+}
+
+void FrozenRanking::getLowestKeys( unsigned amount, std::vector< StringHashData* > &words ) const
+{
+	// First amount words.
+	words.assign( this->data_.begin(), this->data_.begin() + min( amount, getSize() ) );
+}
+
+void FrozenRanking::printGreatestKeys( unsigned rank_size ) const
+{
+	// Print rank_size words, greatest keys first.
+	printRanking( rank_size, true );
+}
+
+void FrozenRanking::printLowestKeys( unsigned rank_size ) const
+{
+	// Print rank_size words, lowest keys first.
+	printRanking( rank_size, false );
+}
+
+unsigned FrozenRanking::writeRange( RankingSink &sink, double low, double high, bool descending,
+		unsigned amount ) const
+{
+	// Range's words lie between the first key not lower than low and the first key
+	// greater than high.
+	unsigned first = countLowerKeys( low );
+	unsigned last = getSize() - countGreaterKeys( high );
+	if( last < first )
+		last = first;  // Empty range (low greater than high).
+
+	// Write each word in range, from either end, up to amount.
+	sink.begin( getKeyOrder() );
+	for( unsigned i = 0; i < last - first && i < amount; ++i )
+		sink.write( this->data_[ descending ? last - 1 - i : first + i ] );
+	sink.end();
+
+	return sink.getWrittenAmount();
+}
+
+std::size_t FrozenRanking::getAllocatedBytes() const
+{
+	// Return bytes allocated by every array.
+	return this->keys_.capacity() * sizeof( double ) +
+			this->data_.capacity() * sizeof( StringHashData* ) +
+			this->eytzinger_.capacity() * sizeof( double ) +
+			this->positions_.capacity() * sizeof( unsigned );
+}
+
+double FrozenRanking::keyOf( StringHashData *data ) const
+{
+	// Score or frequency, according to sorting order.
+	return ( getKeyOrder() == SortBy::SCORE ) ?
+			data->getScore() : static_cast< double >( data->getFrequency() );
+}
+
+unsigned FrozenRanking::layout( unsigned node, unsigned position )
+{
+	// Node past the end has no key.
+	if( node >= this->eytzinger_.size() )
+		return position;
+
+	// Lower keys go to the left subtree, then this node's key, then greater ones.
+	position = layout( 2 * node, position );
+	this->eytzinger_[ node ] = this->keys_[ position ];
+	this->positions_[ node ] = position;
+
+	return layout( 2 * node + 1, position + 1 );
+}
+
+unsigned FrozenRanking::lowerBound( double key, bool or_equal ) const
+{
+	// Descend implicit tree: to the right (2i + 1) past lower keys (and past equal ones,
+	// unless an equal key is the answer), to the left (2i) otherwise.
+	unsigned node = 1;
+	unsigned size = getSize();
+	if( or_equal )
+		while( node <= size )
+			node = 2 * node + ( this->eytzinger_[ node ] < key );
+	else
+		while( node <= size )
+			node = 2 * node + ( this->eytzinger_[ node ] <= key );
+
+	// Answer is the last node where search went left: drop trailing moves to the right
+	// (one bits) and the move to the left before them (a zero bit).
+	node >>= __builtin_ffs( ~node );
+
+	return ( node == 0 ) ? size : this->positions_[ node ];
+}
+
+void FrozenRanking::printRanking( unsigned rank_size, bool descending ) const
+{
+	// Amount of digits in rank_size.
+	unsigned digits_amount = 0;
+	for( unsigned size = rank_size; size > 0; size /= 10 )
+		++digits_amount;
+
+	// Print every key's words, straight from the array.
+	RankingSink sink( cout, SinkFormat::CONSOLE, digits_amount );
+	writeRange( sink, -numeric_limits< double >::infinity(), numeric_limits< double >::infinity(),
+			descending, rank_size );
+}
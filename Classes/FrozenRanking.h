@@ -0,0 +1,191 @@
+/**
+ * Definitions of FrozenRanking class - immutable ranking of StringHashData by score or
+ * frequency, stored as sorted arrays; an alternative to AvlTree for rankings that are
+ * built at once and only queried afterwards.
+ *
+ * Keys and data are kept in two arrays, both in increasing order of keys (ties by word's
+ * id), so walking a ranking from either end reads consecutive memory and the word at a
+ * given rank is a single access. Keys are also copied in Eytzinger order (the order of a
+ * breadth-first walk of a balanced search tree: root at 1, descendants of i at 2i and
+ * 2i + 1), so the first levels of every search share the same few cache lines and each
+ * step down only computes the next position, without branches.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef FROZENRANKING_H_
+#define FROZENRANKING_H_
+
+// Libraries:
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "AvlTreeNode.h"
+#include "RankingSink.h"
+
+
+class FrozenRanking {
+public:
+	/**
+	 * Constructor: create an empty ranking.
+	 *  @param order Sorting order for this ranking's keys (SCORE or FREQUENCY).
+	 */
+	FrozenRanking( SortBy order );
+
+	/**
+	 * Replace ranking's contents: data is sorted by key (ties by word's id) with a few
+	 * threads, then keys are laid out for searches.
+	 *  @param data Hash table's satellite data to be ranked (in any order).
+	 *  @attention Keys are copied: data whose score changes afterwards keeps its place
+	 *             (and may no longer be found) until ranking is built again.
+	 */
+	void build( std::vector< StringHashData* > data );
+
+	/**
+	 * Clear all data from ranking, releasing memory.
+	 */
+	void clear();
+
+	/**
+	 * Check if ranking is empty.
+	 *  @return True if is empty, false otherwise.
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Get sorting order of keys.
+	 *  @return Sorting order.
+	 */
+	SortBy getKeyOrder() const;
+
+	/**
+	 * Get amount of data in ranking.
+	 *  @return Amount of words.
+	 */
+	unsigned getSize() const;
+
+	/**
+	 * Count data with keys lower than a given key.
+	 *  @param key Score or frequency.
+	 *  @return Amount of data with lower keys.
+	 */
+	unsigned countLowerKeys( double key ) const;
+
+	/**
+	 * Count data with keys greater than a given key.
+	 *  @param key Score or frequency.
+	 *  @return Amount of data with greater keys.
+	 */
+	unsigned countGreaterKeys( double key ) const;
+
+	/**
+	 * Get a word's rank, greatest key first. Words with equal keys share the same rank,
+	 * the best among them.
+	 *  @param data Hash table's satellite data to be ranked.
+	 *  @return Rank (1 for the greatest key), 0 if data isn't in the ranking.
+	 */
+	unsigned getRank( StringHashData *data ) const;
+
+	/**
+	 * Get word at a given rank, greatest key first.
+	 *  @param rank Position in ranking (1 ~ getSize()).
+	 *  @return Word's satellite data, null pointer if rank is out of range.
+	 */
+	StringHashData* select( unsigned rank ) const;
+
+	/**
+	 * Get percentile of a key: percentage of data with lower keys, plus half of the data
+	 * with equal keys.
+	 *  @param key Score or frequency.
+	 *  @return Percentile (0.0 ~ 100.0), 0.0 if ranking is empty.
+	 */
+	double getPercentile( double key ) const;
+
+	/**
+	 * Get words with the greatest keys, in decreasing order of keys.
+	 *  @param amount Amount of words wanted.
+	 *  @param words Vector to be filled with words' satellite data (emptied first).
+	 */
+	void getGreatestKeys( unsigned amount, std::vector< StringHashData* > &words ) const;
+
+	/**
+	 * Get words with the lowest keys, in increasing order of keys.
+	 *  @param amount Amount of words wanted.
+	 *  @param words Vector to be filled with words' satellite data (emptied first).
+	 */
+	void getLowestKeys( unsigned amount, std::vector< StringHashData* > &words ) const;
+
+	/**
+	 * Print rank_size words with the greatest keys.
+	 *  @param rank_size Amount of words in ranking list.
+	 */
+	void printGreatestKeys( unsigned rank_size ) const;
+
+	/**
+	 * Print rank_size words with the lowest keys.
+	 *  @param rank_size Amount of words in ranking list.
+	 */
+	void printLowestKeys( unsigned rank_size ) const;
+
+	/**
+	 * Write words with keys in a range to a sink, between its begin() and end(). The range
+	 * is found by two searches, then words are read in order from the array.
+	 *  @param sink Destination of words.
+	 *  @param low Lowest key in range.
+	 *  @param high Greatest key in range.
+	 *  @param descending Indicate if greatest keys come first.
+	 *  @param amount Maximum amount of words written (optional).
+	 *  @return Amount of words written.
+	 */
+	unsigned writeRange( RankingSink &sink, double low, double high, bool descending,
+			unsigned amount = std::numeric_limits< unsigned >::max() ) const;
+
+	/**
+	 * Get memory allocated for the arrays.
+	 *  @return Bytes allocated outside the object itself.
+	 */
+	std::size_t getAllocatedBytes() const;
+
+private:
+	/**
+	 * Get data's key in this ranking's sorting order.
+	 *  @param data Hash table's satellite data.
+	 *  @return Score or frequency.
+	 */
+	double keyOf( StringHashData *data ) const;
+
+	/**
+	 * Copy sorted keys to Eytzinger order, visiting its implicit tree in order.
+	 *  @param node Position in Eytzinger order (1 for the root).
+	 *  @param position Next sorted key to be copied.
+	 *  @return Next sorted key to be copied after node's subtree.
+	 */
+	unsigned layout( unsigned node, unsigned position );
+
+	/**
+	 * Find first sorted key that is greater than (or equal to) a given key.
+	 *  @param key Score or frequency.
+	 *  @param or_equal Indicate if an equal key counts.
+	 *  @return Position in sorted keys (getSize() if there's none).
+	 */
+	unsigned lowerBound( double key, bool or_equal ) const;
+
+	/**
+	 * Print a ranking list, numbered from 1 with as many digits as rank_size has.
+	 *  @param rank_size Amount of words asked for.
+	 *  @param descending Indicate if greatest keys come first.
+	 */
+	void printRanking( unsigned rank_size, bool descending ) const;
+
+
+// Attributes:
+	std::vector< double > keys_;            // Keys, in increasing order.
+	std::vector< StringHashData* > data_;   // Data, in the same order.
+	std::vector< double > eytzinger_;       // Keys in Eytzinger order (position 0 unused).
+	std::vector< unsigned > positions_;     // Position in keys_ of each Eytzinger key.
+	SortBy key_order_;                      // Sorting order of keys.
+};
+
+#endif /* FROZENRANKING_H_ */
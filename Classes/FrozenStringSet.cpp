@@ -0,0 +1,204 @@
+/**
+ * Class FrozenStringSet member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <algorithm>
+#include <cstring>
+#include "FrozenStringSet.h"
+
+using namespace std;
+
+
+FrozenStringSet::FrozenStringSet( StringHasher hasher )
+	: hasher_( hasher )  // Hashing function.
+{
+	// Set is empty.
+	this->size_ = 0;
+}
+
+bool FrozenStringSet::build( std::vector< std::string > words )
+{
+	// Clear previous contents.
+	this->displacements_.clear();
+	this->entries_.clear();
+	this->characters_.clear();
+	this->size_ = 0;
+
+	// Remove repeated words.
+	sort( words.begin(), words.end() );
+	words.erase( unique( words.begin(), words.end() ), words.end() );
+
+	if( words.empty() )
+		return true;
+
+	// Hash each word once.
+	vector< uint64_t > hashes;
+	for( auto &word : words )
+		hashes.push_back( this->hasher_.hash( word ) );
+
+	// Different words sharing a hash value can't be told apart by any displacement.
+	vector< uint64_t > sorted_hashes( hashes );
+	sort( sorted_hashes.begin(), sorted_hashes.end() );
+	if( adjacent_find( sorted_hashes.begin(), sorted_hashes.end() ) != sorted_hashes.end() )
+		return false;
+
+	// One bucket per BUCKET_SIZE words.
+	this->displacements_.assign( ( words.size() + BUCKET_SIZE - 1 ) / BUCKET_SIZE, 0 );
+
+	// Start with one position per word; add positions only if some bucket can't be placed.
+	unsigned positions = words.size();
+	vector< unsigned > placement;
+	while( !place( hashes, positions, placement ) )
+		++positions;
+
+	// Store words back to back, each position pointing to its word.
+	this->entries_.assign( positions, Entry{ 0, FREE } );
+	for( unsigned i = 0; i < positions; ++i )
+	{
+		if( placement[ i ] == FREE )
+			continue;
+
+		const string &word = words[ placement[ i ] ];
+		this->entries_[ i ] = Entry{ static_cast< uint32_t >( this->characters_.size() ),
+				static_cast< uint32_t >( word.size() ) };
+		this->characters_ += word;
+	}
+
+	this->size_ = words.size();
+
+	// Set was built.
+	return true;
+}
+
+bool FrozenStringSet::contains( std::string_view word ) const
+{
+	// Hash word, then search for it.
+	return contains( word, this->hasher_.hash( word ) );
+}
+
+bool FrozenStringSet::contains( std::string_view word, uint64_t hash_value ) const
+{
+	// Empty set contains no word.
+	if( this->size_ == 0 )
+		return false;
+
+	// Only word that may be equal to given one.
+	const Entry &entry = this->entries_[ position( hash_value,
+			this->displacements_[ bucket( hash_value ) ], this->entries_.size() ) ];
+
+	// Compare length, then characters.
+	bool is_found = entry.length == word.size() &&
+			memcmp( this->characters_.data() + entry.offset, word.data(), word.size() ) == 0;
+
+	// A single position is ever checked.
+	this->stats_.recordLookup( is_found, 1 );
+
+	return is_found;
+}
+
+unsigned FrozenStringSet::getSize() const
+{
+	// Return amount of words stored.
+	return this->size_;
+}
+
+unsigned FrozenStringSet::getPositionsAmount() const
+{
+	// Return amount of positions.
+	return this->entries_.size();
+}
+
+HashTableStats FrozenStringSet::getStats() const
+{
+	// Memory used by displacements, positions and words.
+	size_t bytes = sizeof( *this ) + this->displacements_.capacity() * sizeof( uint32_t ) +
+			this->entries_.capacity() * sizeof( Entry ) + this->characters_.capacity();
+
+	// Counters along with current occupation (no tombstones in a frozen set).
+	HashTableStats stats = this->stats_;
+	stats.setOccupation( getSize(), getPositionsAmount(), 0, bytes );
+
+	return stats;
+}
+
+unsigned FrozenStringSet::position( uint64_t hash_value, uint32_t displacement,
+		unsigned positions ) const
+{
+	// Mix hash value with displacement, so each displacement gives another position.
+	uint64_t mixed = hash_value ^ ( displacement * 0x9E3779B97F4A7C15ULL );
+	mixed ^= mixed >> 33;
+	mixed *= 0xFF51AFD7ED558CCDULL;
+	mixed ^= mixed >> 33;
+
+	return mixed % positions;
+}
+
+unsigned FrozenStringSet::bucket( uint64_t hash_value ) const
+{
+	// Return bucket of hash value.
+	return hash_value % this->displacements_.size();
+}
+
+bool FrozenStringSet::place( const std::vector< uint64_t > &hashes, unsigned positions,
+		std::vector< unsigned > &placement )
+{
+	// Words (indexes into hashes) of each bucket.
+	vector< vector< unsigned > > buckets( this->displacements_.size() );
+	for( unsigned i = 0; i < hashes.size(); ++i )
+		buckets[ bucket( hashes[ i ] ) ].push_back( i );
+
+	// Place biggest buckets first, while most positions are free.
+	vector< unsigned > order( buckets.size() );
+	for( unsigned i = 0; i < order.size(); ++i )
+		order[ i ] = i;
+	stable_sort( order.begin(), order.end(), [ &buckets ]( unsigned a, unsigned b )
+			{ return buckets[ a ].size() > buckets[ b ].size(); } );
+
+	// Word's index at each position.
+	placement.assign( positions, FREE );
+	// Positions taken by bucket being placed.
+	vector< unsigned > taken;
+
+	for( unsigned b : order )
+	{
+		bool is_placed = buckets[ b ].empty();
+
+		// Try displacements until every word of the bucket lands on a free position.
+		for( uint32_t displacement = 0; !is_placed && displacement < MAX_DISPLACEMENT; ++displacement )
+		{
+			taken.clear();
+			is_placed = true;
+
+			for( unsigned i = 0; i < buckets[ b ].size() && is_placed; ++i )
+			{
+				unsigned p = position( hashes[ buckets[ b ][ i ] ], displacement, positions );
+
+				// Position must be free and not taken by another word of this bucket.
+				if( placement[ p ] != FREE || find( taken.begin(), taken.end(), p ) != taken.end() )
+					is_placed = false;
+				else
+					taken.push_back( p );
+			}
+
+			// Keep displacement and mark positions.
+			if( is_placed )
+			{
+				this->displacements_[ b ] = displacement;
+				for( unsigned i = 0; i < taken.size(); ++i )
+					placement[ taken[ i ] ] = buckets[ b ][ i ];
+			}
+		}
+
+		// Bucket couldn't be placed with this amount of positions.
+		if( !is_placed )
+			return false;
+	}
+
+	// Every bucket was placed.
+	return true;
+}
@@ -0,0 +1,128 @@
+/**
+ * Definitions of FrozenStringSet class - immutable set of strings stored with a
+ * minimal perfect hash (hash and displace), used for stopwords.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef FROZENSTRINGSET_H_
+#define FROZENSTRINGSET_H_
+
+// Libraries:
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "StringHasher.h"
+#include "HashTableStats.h"
+
+
+/**
+ * Words are split into buckets by their hash value. Each bucket gets a displacement
+ * chosen when the set is built so that every word of the bucket lands on a position
+ * no other word uses: position = mix( hash, displacement ) % size. With as many
+ * positions as words, membership is one hash, one displacement lookup and one memcmp.
+ *
+ * Words are stored back to back in a single buffer, so the set holds no object per word.
+ */
+class FrozenStringSet {
+public:
+	/**
+	 * Constructor: create an empty set.
+	 *  @param hasher Hashing function (must be the same one used to calculate hash
+	 *                values passed to contains()).
+	 */
+	FrozenStringSet( StringHasher hasher = StringHasher() );
+
+	/**
+	 * Build set from a list of words, replacing previous contents.
+	 *  @param words Words to be stored (repetitions are ignored).
+	 *  @return True if built, false if two different words share a hash value.
+	 */
+	bool build( std::vector< std::string > words );
+
+	/**
+	 * Check if a word is in the set.
+	 *  @param word Word to be searched for.
+	 *  @return True if found, false otherwise.
+	 */
+	bool contains( std::string_view word ) const;
+
+	/**
+	 * Check if a word is in the set using an already calculated hash value.
+	 *  @param word Word to be searched for.
+	 *  @param hash_value Word's hash value, calculated by this set's hashing function.
+	 *  @return True if found, false otherwise.
+	 */
+	bool contains( std::string_view word, uint64_t hash_value ) const;
+
+	/**
+	 * Get amount of words stored.
+	 *  @return Amount of words.
+	 */
+	unsigned getSize() const;
+
+	/**
+	 * Get amount of positions (equal to amount of words unless a bucket couldn't be
+	 * placed, in which case the set was rebuilt with one more position).
+	 *  @return Amount of positions.
+	 */
+	unsigned getPositionsAmount() const;
+
+	/**
+	 * Get counters of lookups (always one probe each), along with current occupation and
+	 * memory used.
+	 *  @return Copy of counters.
+	 */
+	HashTableStats getStats() const;
+
+private:
+	/**
+	 * Calculate position of a hash value given its bucket's displacement.
+	 *  @param hash_value Word's hash value.
+	 *  @param displacement Bucket's displacement.
+	 *  @param positions Amount of positions.
+	 *  @return Position in entries_.
+	 */
+	unsigned position( uint64_t hash_value, uint32_t displacement, unsigned positions ) const;
+
+	/**
+	 * Calculate bucket of a hash value.
+	 *  @param hash_value Word's hash value.
+	 *  @return Index in displacements_.
+	 */
+	unsigned bucket( uint64_t hash_value ) const;
+
+	/**
+	 * Try to find a displacement for every bucket with a given amount of positions.
+	 *  @param hashes Words' hash values.
+	 *  @param positions Amount of positions.
+	 *  @param placement Word's index at each position, if successful.
+	 *  @return True if every bucket was placed, false otherwise.
+	 */
+	bool place( const std::vector< uint64_t > &hashes, unsigned positions,
+			std::vector< unsigned > &placement );
+
+
+	// Word stored at a position.
+	struct Entry {
+		uint32_t offset;  // Offset of first character in characters_.
+		uint32_t length;  // Amount of characters (FREE if position is free).
+	};
+
+// Attributes:
+	StringHasher hasher_;                   // Hashing function.
+	std::vector< uint32_t > displacements_; // Displacement of each bucket.
+	std::vector< Entry > entries_;          // Word at each position.
+	std::string characters_;                // Every word, back to back.
+	unsigned size_;                         // Amount of words stored.
+	mutable HashTableStats stats_;          // Counters of lookups (updated by const lookups).
+
+	static constexpr uint32_t FREE = 0xFFFFFFFF;      // Length of a free position.
+	static constexpr unsigned BUCKET_SIZE = 4;        // Average amount of words per bucket.
+	static constexpr uint32_t MAX_DISPLACEMENT = 1 << 20;  // Attempts per bucket.
+};
+
+#endif /* FROZENSTRINGSET_H_ */
@@ -0,0 +1,199 @@
+/**
+ * Class HashTableStats member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <iomanip>
+#include <algorithm>
+#include "HashTableStats.h"
+
+using namespace std;
+
+
+HashTableStats::HashTableStats()
+	: hit_probes_( MAX_PROBES + 1, 0 ),  // One bin per amount of probes.
+	  miss_probes_( MAX_PROBES + 1, 0 )
+{
+	// No rehash occurred.
+	this->rehashes_ = 0;
+	this->rehash_time_ = 0.0;
+	this->max_pause_ = 0.0;
+
+	// Table is empty.
+	setOccupation( 0, 0, 0, 0 );
+}
+
+void HashTableStats::recordLookup( bool is_found, unsigned probes )
+{
+	// Count lookup in its bin.
+	vector< unsigned long long > &bins = is_found ? this->hit_probes_ : this->miss_probes_;
+	bins[ min( probes, MAX_PROBES ) ]++;
+}
+
+void HashTableStats::recordRehash( unsigned amount, unsigned size )
+{
+	// Count rehash and sample occupation.
+	this->rehashes_++;
+	this->load_samples_.push_back( LoadSample{ getLookups( true ) + getLookups( false ), amount, size } );
+}
+
+void HashTableStats::recordPause( double pause )
+{
+	// Add pause to total time and keep the longest one.
+	this->rehash_time_ += pause;
+	if( pause > this->max_pause_ )
+		this->max_pause_ = pause;
+}
+
+void HashTableStats::setOccupation( unsigned amount, unsigned size, unsigned tombstones,
+		std::size_t bytes )
+{
+	this->amount_ = amount;          // Amount of data stored.
+	this->size_ = size;              // Table's size.
+	this->tombstones_ = tombstones;  // Positions left by removed data.
+	this->bytes_ = bytes;            // Memory used.
+}
+
+unsigned long long HashTableStats::getLookups( bool is_found ) const
+{
+	// Sum every bin.
+	unsigned long long lookups = 0;
+	for( auto lookups_in_bin : getProbes( is_found ) )
+		lookups += lookups_in_bin;
+
+	return lookups;
+}
+
+const std::vector< unsigned long long >& HashTableStats::getProbes( bool is_found ) const
+{
+	// Return histogram.
+	return is_found ? this->hit_probes_ : this->miss_probes_;
+}
+
+double HashTableStats::getAverageProbes( bool is_found ) const
+{
+	// Weighted sum of bins.
+	const vector< unsigned long long > &bins = getProbes( is_found );
+	unsigned long long probes = 0;
+	for( unsigned i = 0; i < bins.size(); ++i )
+		probes += i * bins[ i ];
+
+	unsigned long long lookups = getLookups( is_found );
+	return lookups == 0 ? 0.0 : static_cast< double >( probes ) / lookups;
+}
+
+unsigned HashTableStats::getRehashesNum() const
+{
+	// Return amount of rehashes.
+	return this->rehashes_;
+}
+
+double HashTableStats::getRehashTime() const
+{
+	// Return total time spent rehashing.
+	return this->rehash_time_;
+}
+
+double HashTableStats::getMaxPause() const
+{
+	// Return longest pause.
+	return this->max_pause_;
+}
+
+const std::vector< HashTableStats::LoadSample >& HashTableStats::getLoadSamples() const
+{
+	// Return samples.
+	return this->load_samples_;
+}
+
+double HashTableStats::getLoadFactor() const
+{
+	// Rate of occupied space.
+	return this->size_ == 0 ? 0.0 : static_cast< double >( this->amount_ ) / this->size_;
+}
+
+double HashTableStats::getBytesPerEntry() const
+{
+	// Memory per stored data.
+	return this->amount_ == 0 ? 0.0 : static_cast< double >( this->bytes_ ) / this->amount_;
+}
+
+void HashTableStats::print( std::ostream &out, const std::string &name ) const
+{
+	// Keep stream's format to restore it afterwards.
+	ios_base::fmtflags flags = out.flags();
+	streamsize precision = out.precision();
+
+	out << "-- " << name << " --\n"
+			<< fixed << setprecision( 2 )
+			<< "entries        : " << this->amount_ << " in " << this->size_ << " positions ("
+			<< this->tombstones_ << " tombstones)\n"
+			<< "load factor    : " << getLoadFactor() << '\n'
+			<< "bytes/entry    : " << getBytesPerEntry() << '\n'
+			<< "lookups        : " << getLookups( true ) << " hits (" << getAverageProbes( true )
+			<< " probes avg), " << getLookups( false ) << " misses (" << getAverageProbes( false )
+			<< " probes avg)\n"
+			<< "rehashes       : " << getRehashesNum() << " (" << getRehashTime() << " us total, "
+			<< getMaxPause() << " us longest pause)\n";
+
+	// Histogram, skipping empty bins.
+	out << "probes : hits / misses\n";
+	for( unsigned i = 0; i <= MAX_PROBES; ++i )
+		if( this->hit_probes_[ i ] != 0 || this->miss_probes_[ i ] != 0 )
+			out << setw( 5 ) << i << ( i == MAX_PROBES ? "+" : " " ) << ": "
+					<< this->hit_probes_[ i ] << " / " << this->miss_probes_[ i ] << '\n';
+
+	// Load factor when each rehash was triggered.
+	for( auto &sample : getLoadSamples() )
+		out << "rehash after " << sample.lookups << " lookups at load "
+				<< static_cast< double >( sample.amount ) / sample.size
+				<< " (" << sample.amount << " / " << sample.size << ")\n";
+
+	out.flags( flags );
+	out.precision( precision );
+}
+
+void HashTableStats::printJson( std::ostream &out ) const
+{
+	// Keep stream's format to restore it afterwards.
+	ios_base::fmtflags flags = out.flags();
+	streamsize precision = out.precision();
+
+	out << fixed << setprecision( 4 )
+			<< "{\"entries\":" << this->amount_
+			<< ",\"size\":" << this->size_
+			<< ",\"tombstones\":" << this->tombstones_
+			<< ",\"load_factor\":" << getLoadFactor()
+			<< ",\"bytes\":" << this->bytes_
+			<< ",\"bytes_per_entry\":" << getBytesPerEntry()
+			<< ",\"rehashes\":" << getRehashesNum()
+			<< ",\"rehash_time_us\":" << getRehashTime()
+			<< ",\"max_pause_us\":" << getMaxPause();
+
+	// Histograms: amount of lookups that needed i probes at index i.
+	for( bool is_found : { true, false } )
+	{
+		out << ( is_found ? ",\"hit_probes\":[" : ",\"miss_probes\":[" );
+		for( unsigned i = 0; i <= MAX_PROBES; ++i )
+			out << ( i == 0 ? "" : "," ) << getProbes( is_found )[ i ];
+		out << ']';
+	}
+
+	out << ",\"load_samples\":[";
+	for( unsigned i = 0; i < getLoadSamples().size(); ++i )
+	{
+		const LoadSample &sample = getLoadSamples()[ i ];
+		out << ( i == 0 ? "" : "," )
+				<< "{\"lookups\":" << sample.lookups
+				<< ",\"entries\":" << sample.amount
+				<< ",\"size\":" << sample.size << '}';
+	}
+	out << "]}";
+
+	out.flags( flags );
+	out.precision( precision );
+}
@@ -0,0 +1,155 @@
+/**
+ * Definitions of HashTableStats class - live counters of a hash table's lookups,
+ * rehashes and occupation, printable as text or JSON.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef HASHTABLESTATS_H_
+#define HASHTABLESTATS_H_
+
+// Libraries:
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+class HashTableStats {
+public:
+	/**
+	 * Occupation of the table when it was rehashed.
+	 */
+	struct LoadSample {
+		unsigned long long lookups;  // Lookups done so far (time axis).
+		unsigned amount;             // Amount of data stored.
+		unsigned size;               // Table's size before rehashing.
+	};
+
+	/**
+	 * Constructor: all counters start at zero.
+	 */
+	HashTableStats();
+
+	/**
+	 * Count a lookup and how many probes it needed.
+	 *  @param is_found True if word was found, false otherwise.
+	 *  @param probes Amount of groups (or positions) checked.
+	 */
+	void recordLookup( bool is_found, unsigned probes );
+
+	/**
+	 * Count a rehash and sample the occupation that triggered it, along with lookups
+	 * counted so far.
+	 *  @param amount Amount of data stored.
+	 *  @param size Table's size before rehashing.
+	 */
+	void recordRehash( unsigned amount, unsigned size );
+
+	/**
+	 * Add time spent rehashing by a single operation.
+	 *  @param pause Time spent, in microseconds.
+	 */
+	void recordPause( double pause );
+
+	/**
+	 * Set table's current occupation, reported along with the counters.
+	 *  @param amount Amount of data stored.
+	 *  @param size Table's size.
+	 *  @param tombstones Amount of positions left by removed data.
+	 *  @param bytes Memory used by the table and its satellite data.
+	 */
+	void setOccupation( unsigned amount, unsigned size, unsigned tombstones, std::size_t bytes );
+
+	/**
+	 * Get amount of lookups.
+	 *  @param is_found True to count successful lookups, false for unsuccessful ones.
+	 *  @return Amount of lookups.
+	 */
+	unsigned long long getLookups( bool is_found ) const;
+
+	/**
+	 * Get histogram of probes per lookup.
+	 *  @param is_found True for successful lookups, false for unsuccessful ones.
+	 *  @return Amount of lookups that needed i probes at index i (last index counts
+	 *          every lookup that needed MAX_PROBES or more).
+	 */
+	const std::vector< unsigned long long >& getProbes( bool is_found ) const;
+
+	/**
+	 * Get average probes per lookup.
+	 *  @param is_found True for successful lookups, false for unsuccessful ones.
+	 *  @return Average probes (zero if there were no lookups).
+	 */
+	double getAverageProbes( bool is_found ) const;
+
+	/**
+	 * Get amount of times the table was rehashed.
+	 *  @return Number of rehashes.
+	 */
+	unsigned getRehashesNum() const;
+
+	/**
+	 * Get total time spent rehashing.
+	 *  @return Time in microseconds.
+	 */
+	double getRehashTime() const;
+
+	/**
+	 * Get longest time a single operation spent rehashing.
+	 *  @return Maximum pause in microseconds.
+	 */
+	double getMaxPause() const;
+
+	/**
+	 * Get occupation sampled at each rehash.
+	 *  @return Samples, oldest first.
+	 */
+	const std::vector< LoadSample >& getLoadSamples() const;
+
+	/**
+	 * Get rate of table's occupied space.
+	 *  @return Load factor.
+	 */
+	double getLoadFactor() const;
+
+	/**
+	 * Get memory used per stored data.
+	 *  @return Bytes per entry (zero if table is empty).
+	 */
+	double getBytesPerEntry() const;
+
+	/**
+	 * Print counters as text.
+	 *  @param out Stream to print to.
+	 *  @param name Table's name.
+	 */
+	void print( std::ostream &out, const std::string &name ) const;
+
+	/**
+	 * Print counters as a JSON object.
+	 *  @param out Stream to print to.
+	 */
+	void printJson( std::ostream &out ) const;
+
+	static constexpr unsigned MAX_PROBES = 16;  // Probes from which lookups share a bin.
+
+private:
+// Attributes:
+	std::vector< unsigned long long > hit_probes_;   // Probes of successful lookups.
+	std::vector< unsigned long long > miss_probes_;  // Probes of unsuccessful lookups.
+
+	unsigned rehashes_;       // Number of rehashes.
+	double rehash_time_;      // Total time spent rehashing (microseconds).
+	double max_pause_;        // Longest time an operation spent rehashing (microseconds).
+	std::vector< LoadSample > load_samples_;  // Occupation at each rehash.
+
+	unsigned amount_;         // Amount of data stored.
+	unsigned size_;           // Table's size.
+	unsigned tombstones_;     // Positions left by removed data.
+	std::size_t bytes_;       // Memory used by the table and its satellite data.
+};
+
+#endif /* HASHTABLESTATS_H_ */
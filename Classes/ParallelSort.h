@@ -0,0 +1,66 @@
+/**
+ * Definition of parallelSort() - sorts a vector with one thread per core.
+ *
+ * Elements are split in as many chunks as there are cores (unless chunks would get too
+ * small), each chunk is sorted by its own thread, and neighbouring sorted runs are merged
+ * in rounds, doubling their width each round; merges of a round don't overlap, so they
+ * run in parallel as well.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef PARALLELSORT_H_
+#define PARALLELSORT_H_
+
+// Libraries:
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+
+/**
+ * Sort a vector with a few threads.
+ *  @param elements Elements to be sorted.
+ *  @param less Strict weak ordering of elements.
+ *  @param min_chunk Fewest elements worth sorting by a thread of their own.
+ */
+template< typename T, typename Compare >
+void parallelSort( std::vector< T > &elements, Compare less, std::size_t min_chunk = 16384 )
+{
+	// Split elements in chunks, one per core (unless chunks would get too small).
+	std::size_t chunks = std::max( std::thread::hardware_concurrency(), 1u );
+	chunks = std::min( chunks, std::max< std::size_t >( elements.size() / std::max< std::size_t >( min_chunk, 1 ), 1 ) );
+	std::vector< std::size_t > bounds;
+	for( std::size_t c = 0; c <= chunks; ++c )
+		bounds.push_back( elements.size() * c / chunks );
+
+	// Sort each chunk in its own thread (first one in this thread).
+	std::vector< std::thread > threads;
+	for( std::size_t c = 1; c < chunks; ++c )
+		threads.emplace_back( [ &elements, &bounds, &less, c ]()
+		{
+			std::sort( elements.begin() + bounds[ c ], elements.begin() + bounds[ c + 1 ], less );
+		} );
+	std::sort( elements.begin() + bounds[ 0 ], elements.begin() + bounds[ 1 ], less );
+	for( auto &worker : threads )
+		worker.join();
+
+	// Merge neighbouring sorted runs, doubling their width each round.
+	for( std::size_t width = 1; width < chunks; width *= 2 )
+	{
+		threads.clear();
+		for( std::size_t c = 0; c + width < chunks; c += 2 * width )
+			threads.emplace_back( [ &elements, &bounds, &less, c, width, chunks ]()
+			{
+				std::inplace_merge( elements.begin() + bounds[ c ], elements.begin() + bounds[ c + width ],
+						elements.begin() + bounds[ std::min( c + 2 * width, chunks ) ], less );
+			} );
+		for( auto &worker : threads )
+			worker.join();
+	}
+}
+
+#endif /* PARALLELSORT_H_ */
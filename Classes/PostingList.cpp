@@ -0,0 +1,306 @@
+/**
+ * Class PostingList member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <algorithm>
+#include "PostingList.h"
+
+using namespace std;
+
+
+/**
+ * Decode a number with variable-length byte encoding.
+ *  @param position First byte of number; moved past its last byte.
+ *  @return Number.
+ */
+static uint64_t decodeNumber( const uint8_t *&position )
+{
+	// Gather 7 bits per byte, lowest ones first, until a byte with its high bit clear.
+	uint64_t number = 0;
+	unsigned shift = 0;
+	uint8_t byte;
+	do
+	{
+		byte = *position++;
+		number |= static_cast< uint64_t >( byte & 0x7F ) << shift;
+		shift += 7;
+	} while( byte & 0x80 );
+
+	return number;
+}
+
+
+PostingList::Iterator::Iterator( const uint8_t *position, const uint8_t *end, unsigned previous )
+{
+	// Point to given index and decode it.
+	this->position_ = position;
+	this->end_ = end;
+	decode( previous );
+}
+
+unsigned PostingList::Iterator::operator*() const
+{
+	// Return current index.
+	return this->index_;
+}
+
+PostingList::Iterator& PostingList::Iterator::operator++()
+{
+	// Move to next index, adding its difference to current one.
+	this->position_ = this->next_;
+	decode( this->index_ );
+
+	return *this;
+}
+
+PostingList::Iterator PostingList::Iterator::operator++( int )
+{
+	// Keep a copy before moving.
+	Iterator previous = *this;
+	++*this;
+
+	return previous;
+}
+
+bool PostingList::Iterator::hasPositions() const
+{
+	// Return whether a block follows current index.
+	return this->block_ != nullptr;
+}
+
+void PostingList::Iterator::getPositions( std::vector< unsigned > &positions ) const
+{
+	// Index without a block has no positions.
+	positions.clear();
+	if( !hasPositions() )
+		return;
+
+	// Decode positions until block's ending zero byte (no encoded position has a zero byte).
+	const uint8_t *byte = this->block_;
+	while( *byte != 0 )
+		positions.push_back( static_cast< unsigned >( decodeNumber( byte ) ) - 1 );
+}
+
+bool PostingList::Iterator::operator==( const Iterator &other ) const
+{
+	// Same index if same byte.
+	return this->position_ == other.position_;
+}
+
+bool PostingList::Iterator::operator!=( const Iterator &other ) const
+{
+	// Different index if different byte.
+	return !( *this == other );
+}
+
+void PostingList::Iterator::decode( unsigned previous )
+{
+	// End of list has no index.
+	this->next_ = this->position_;
+	this->block_ = nullptr;
+	this->index_ = previous;
+	if( this->position_ == this->end_ )
+		return;
+
+	// Index is the previous one plus its difference (shifted left by one bit).
+	uint64_t number = decodeNumber( this->next_ );
+	this->index_ = previous + static_cast< unsigned >( number >> 1 );
+
+	// Lowest bit set: a block of positions follows, ended by a zero byte.
+	if( number & 1 )
+	{
+		this->block_ = this->next_;
+		while( *this->next_ != 0 )
+			++this->next_;
+		++this->next_;
+	}
+}
+
+PostingList::PostingList()
+{
+	// No indexes.
+	this->last_ = 0;
+	this->size_ = 0;
+	this->last_entry_ = 0;
+}
+
+bool PostingList::add( unsigned index, unsigned position )
+{
+	// Increasing order (the usual case): append difference to last index.
+	if( empty() || index > back() )
+	{
+		append( index, false );
+		if( position != NO_POSITION )
+			appendPosition( position );
+
+		return true;
+	}
+
+	// Repeated last index: only its position is added.
+	if( index == back() )
+	{
+		if( position != NO_POSITION )
+			appendPosition( position );
+
+		return false;
+	}
+
+	// Smaller index: merge it (or its position) in order.
+	bool is_included = !contains( index );
+	if( is_included || position != NO_POSITION )
+		merge( index, position );
+
+	return is_included;
+}
+
+bool PostingList::contains( unsigned index ) const
+{
+	// Indexes are sorted: stop at the first one not less than index.
+	Iterator i = begin();
+	while( i != end() && *i < index )
+		++i;
+
+	return i != end() && *i == index;
+}
+
+void PostingList::clear()
+{
+	// Release encoded bytes.
+	vector< uint8_t >().swap( this->bytes_ );
+	this->last_ = 0;
+	this->size_ = 0;
+	this->last_entry_ = 0;
+}
+
+unsigned PostingList::size() const
+{
+	// Return amount of indexes.
+	return this->size_;
+}
+
+bool PostingList::empty() const
+{
+	// Return whether there are no indexes.
+	return this->size_ == 0;
+}
+
+unsigned PostingList::back() const
+{
+	// Return largest index.
+	return this->last_;
+}
+
+PostingList::Iterator PostingList::begin() const
+{
+	// First index is encoded as a difference to zero.
+	return Iterator( this->bytes_.data(), this->bytes_.data() + this->bytes_.size() );
+}
+
+PostingList::Iterator PostingList::end() const
+{
+	// Past last byte.
+	const uint8_t *end = this->bytes_.data() + this->bytes_.size();
+	return Iterator( end, end );
+}
+
+std::size_t PostingList::getAllocatedBytes() const
+{
+	// Return bytes allocated for encoded indexes.
+	return this->bytes_.capacity();
+}
+
+std::size_t PostingList::getEncodedBytes() const
+{
+	// Return bytes in use.
+	return this->bytes_.size();
+}
+
+void PostingList::merge( unsigned index, unsigned position )
+{
+	// Index with its positions, decoded.
+	struct Entry {
+		unsigned index;                   // Review's index.
+		bool has_block;                   // Indicate index has a block of positions.
+		std::vector< unsigned > positions;  // Positions in the review.
+	};
+
+	// Decode every index.
+	vector< Entry > entries;
+	for( Iterator i = begin(); i != end(); ++i )
+	{
+		entries.push_back( Entry{ *i, i.hasPositions(), {} } );
+		i.getPositions( entries.back().positions );
+	}
+
+	// Find index's entry, creating it in order if it's missing.
+	auto entry = lower_bound( entries.begin(), entries.end(), index,
+			[]( const Entry &e, unsigned i ) { return e.index < i; } );
+	if( entry == entries.end() || entry->index != index )
+		entry = entries.insert( entry, Entry{ index, false, {} } );
+
+	// Add position to index's block.
+	if( position != NO_POSITION )
+	{
+		entry->has_block = true;
+		entry->positions.push_back( position );
+	}
+
+	// Encode every index again.
+	this->bytes_.clear();
+	this->last_ = 0;
+	this->size_ = 0;
+	for( auto &e : entries )
+	{
+		append( e.index, e.has_block );
+		for( auto p : e.positions )
+			appendPosition( p );
+	}
+}
+
+void PostingList::append( unsigned index, bool has_block )
+{
+	// Difference to last index, shifted left to make room for the block's bit.
+	uint64_t difference = empty() ? index : index - back();
+
+	this->last_entry_ = this->bytes_.size();
+	encode( this->bytes_, ( difference << 1 ) | ( has_block ? 1 : 0 ) );
+
+	// An empty block is just its ending zero byte.
+	if( has_block )
+		this->bytes_.push_back( 0 );
+
+	this->last_ = index;
+	this->size_++;
+}
+
+void PostingList::appendPosition( unsigned position )
+{
+	// If last index has no block, set its bit (lowest bit of the first byte of its
+	// difference, which doesn't change its length) and open an empty block after it.
+	if( !( this->bytes_[ this->last_entry_ ] & 1 ) )
+	{
+		this->bytes_[ this->last_entry_ ] |= 1;
+		this->bytes_.push_back( 0 );
+	}
+
+	// Replace block's ending byte with position, then end block again.
+	this->bytes_.pop_back();
+	encode( this->bytes_, static_cast< uint64_t >( position ) + 1 );
+	this->bytes_.push_back( 0 );
+}
+
+void PostingList::encode( std::vector< uint8_t > &bytes, uint64_t number )
+{
+	// 7 bits per byte, lowest ones first; high bit set on every byte but the last.
+	while( number >= 0x80 )
+	{
+		bytes.push_back( static_cast< uint8_t >( number | 0x80 ) );
+		number >>= 7;
+	}
+	bytes.push_back( static_cast< uint8_t >( number ) );
+}
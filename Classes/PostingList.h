@@ -0,0 +1,223 @@
+/**
+ * Definitions of PostingList class - sorted set of review indexes where a word appears,
+ * compressed with delta and variable-length byte encoding.
+ *
+ * Each index is stored as its difference to the previous one, 7 bits per byte (high bit
+ * set while more bytes follow), so indexes of a frequent word usually take a single byte
+ * each. Indexes arrive in increasing order while reading a file: appending one, or
+ * ignoring a repeated one, compares it with the last index only. An index smaller than
+ * the last one is merged in order, which costs a pass over the list.
+ *
+ * Optionally, an index carries a block with the positions of the word's tokens in that
+ * review (each as position + 1, variable-length encoded, block ended by a zero byte). The
+ * lowest bit of an index's encoded difference tells if a block follows it. Positions of
+ * the last index are appended in constant time.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef POSTINGLIST_H_
+#define POSTINGLIST_H_
+
+// Libraries:
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+
+class PostingList {
+public:
+	/**
+	 * Forward iterator decoding indexes in increasing order, straight from the encoded bytes.
+	 */
+	class Iterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = unsigned;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const unsigned*;
+		using reference = unsigned;
+
+		/**
+		 * Constructor: point to an encoded index.
+		 *  @param position First byte of an index (or end of bytes).
+		 *  @param end End of bytes.
+		 *  @param previous Index before this one (zero for the first).
+		 */
+		Iterator( const uint8_t *position = nullptr, const uint8_t *end = nullptr,
+				unsigned previous = 0 );
+
+		/**
+		 * Get current index.
+		 *  @return Review's index.
+		 */
+		unsigned operator*() const;
+
+		/**
+		 * Move to next index.
+		 *  @return This iterator.
+		 */
+		Iterator& operator++();
+
+		/**
+		 * Move to next index, returning a copy of this iterator before moving.
+		 *  @return Copy of iterator at current index.
+		 */
+		Iterator operator++( int );
+
+		/**
+		 * Check if current index has a block of positions.
+		 *  @return True if it has, false otherwise.
+		 */
+		bool hasPositions() const;
+
+		/**
+		 * Decode positions of the word's tokens in current index's review.
+		 *  @param positions Vector to be filled with positions (emptied first; reusing it
+		 *                   avoids allocations).
+		 */
+		void getPositions( std::vector< unsigned > &positions ) const;
+
+		/**
+		 * Compare positions of two iterators of the same list.
+		 *  @param other Iterator to compare with.
+		 *  @return True if both point to the same index, false otherwise.
+		 */
+		bool operator==( const Iterator &other ) const;
+
+		/**
+		 * Compare positions of two iterators of the same list.
+		 *  @param other Iterator to compare with.
+		 *  @return True if they point to different indexes, false otherwise.
+		 */
+		bool operator!=( const Iterator &other ) const;
+
+	private:
+		/**
+		 * Decode index at current position, if any.
+		 *  @param previous Index before it.
+		 */
+		void decode( unsigned previous );
+
+
+	// Attributes:
+		const uint8_t *position_;  // First byte of current index.
+		const uint8_t *next_;      // First byte of next index.
+		const uint8_t *block_;     // First byte of current index's positions (null if none).
+		const uint8_t *end_;       // End of bytes.
+		unsigned index_;           // Current index (decoded).
+	};
+
+	static constexpr unsigned NO_POSITION = 0xFFFFFFFF;  // Index added without a position.
+
+	/**
+	 * Constructor: create an empty list.
+	 */
+	PostingList();
+
+	/**
+	 * Include a review's index and, optionally, a position of the word in that review.
+	 *  @param index Review's index.
+	 *  @param position Position of the word's token in the review (optional).
+	 *  @return True if index was included, false if it was already included (its position
+	 *          is still added).
+	 *  @attention Constant time if index isn't less than the last one; linear otherwise.
+	 */
+	bool add( unsigned index, unsigned position = NO_POSITION );
+
+	/**
+	 * Check if a review's index is included.
+	 *  @param index Review's index.
+	 *  @return True if it is, false otherwise.
+	 */
+	bool contains( unsigned index ) const;
+
+	/**
+	 * Remove every index and release memory.
+	 */
+	void clear();
+
+	/**
+	 * Get amount of indexes.
+	 *  @return Amount of indexes.
+	 */
+	unsigned size() const;
+
+	/**
+	 * Check if list has no indexes.
+	 *  @return True if empty, false otherwise.
+	 */
+	bool empty() const;
+
+	/**
+	 * Get largest index.
+	 *  @return Last index (zero if list is empty).
+	 */
+	unsigned back() const;
+
+	/**
+	 * Get iterator to smallest index.
+	 *  @return Iterator to first index.
+	 */
+	Iterator begin() const;
+
+	/**
+	 * Get iterator past largest index.
+	 *  @return Iterator to end of list.
+	 */
+	Iterator end() const;
+
+	/**
+	 * Get memory allocated for encoded indexes.
+	 *  @return Bytes allocated outside the object itself.
+	 */
+	std::size_t getAllocatedBytes() const;
+
+	/**
+	 * Get amount of bytes encoding indexes.
+	 *  @return Bytes used.
+	 */
+	std::size_t getEncodedBytes() const;
+
+private:
+	/**
+	 * Decode whole list, add an index (or a position to an index) in order and encode
+	 * list again. Used when an index or position doesn't belong at the end of the list.
+	 *  @param index Review's index.
+	 *  @param position Position of the word's token in the review (or NO_POSITION).
+	 */
+	void merge( unsigned index, unsigned position );
+
+	/**
+	 * Append an index.
+	 *  @param index Review's index (greater than the last one).
+	 *  @param has_block Indicate if an (empty) block of positions follows it.
+	 */
+	void append( unsigned index, bool has_block );
+
+	/**
+	 * Append a position to the last index's block, opening the block if it has none.
+	 *  @param position Position of the word's token in the review.
+	 */
+	void appendPosition( unsigned position );
+
+	/**
+	 * Append a number with variable-length byte encoding.
+	 *  @param bytes Bytes to append to.
+	 *  @param number Number to encode.
+	 */
+	static void encode( std::vector< uint8_t > &bytes, uint64_t number );
+
+
+// Attributes:
+	std::vector< uint8_t > bytes_;  // Differences between consecutive indexes and blocks of
+	                                // positions, encoded.
+	unsigned last_;                 // Largest index.
+	unsigned size_;                 // Amount of indexes.
+	unsigned last_entry_;           // First byte of largest index's difference.
+};
+
+#endif /* POSTINGLIST_H_ */
@@ -0,0 +1,122 @@
+/**
+ * Class RankingSink member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <iomanip>
+#include "RankingSink.h"
+
+using namespace std;
+
+
+RankingSink::RankingSink( std::ostream &out, SinkFormat format, unsigned rank_digits )
+	: out_( out )
+{
+	// No words written yet.
+	this->format_ = format;
+	this->rank_digits_ = rank_digits;
+	this->written_ = 0;
+}
+
+RankingSink::~RankingSink()
+{
+}
+
+void RankingSink::begin( SortBy order )
+{
+	// Ranks start over.
+	this->written_ = 0;
+
+	// Header, according to format.
+	if( this->format_ == SinkFormat::CONSOLE )
+		( order == SortBy::SCORE ) ? this->out_ << "--   Score Ranking   --\n" : this->out_ << "-- Frequency Ranking --\n";
+	else if( this->format_ == SinkFormat::CSV )
+		this->out_ << "rank,word,score,frequency\n";
+	else
+		this->out_ << '[';
+}
+
+void RankingSink::write( StringHashData *data )
+{
+	// Next rank.
+	unsigned rank = ++this->written_;
+
+	// Console: numbered word, rank padded with zeros.
+	if( this->format_ == SinkFormat::CONSOLE )
+	{
+		char fill = this->out_.fill( '0' );
+		this->out_ << setw( this->rank_digits_ ) << rank;
+		this->out_.fill( fill );
+		this->out_ << ". " << data->getWord() << '\n';
+	}
+
+	// CSV: one row per word.
+	else if( this->format_ == SinkFormat::CSV )
+	{
+		this->out_ << rank << ',';
+		writeCsvField( data->getWord() );
+		this->out_ << ',' << data->getScore() << ',' << data->getFrequency() << '\n';
+	}
+
+	// JSON: one object per word, separated by commas.
+	else
+	{
+		this->out_ << ( rank == 1 ? "" : "," ) << "{\"rank\":" << rank << ",\"word\":";
+		writeJsonString( data->getWord() );
+		this->out_ << ",\"score\":" << data->getScore()
+				<< ",\"frequency\":" << data->getFrequency() << '}';
+	}
+}
+
+void RankingSink::end()
+{
+	// Only JSON arrays need closing.
+	if( this->format_ == SinkFormat::JSON )
+		this->out_ << "]\n";
+}
+
+unsigned RankingSink::getWrittenAmount() const
+{
+	// Return amount of words written.
+	return this->written_;
+}
+
+void RankingSink::writeCsvField( std::string_view word )
+{
+	// Plain words are written as they are.
+	if( word.find_first_of( ",\"\r\n" ) == string_view::npos )
+	{
+		this->out_ << word;
+		return;
+	}
+
+	// Otherwise, quoted, with quotes doubled.
+	this->out_ << '"';
+	for( char c : word )
+		( c == '"' ) ? this->out_ << "\"\"" : this->out_ << c;
+	this->out_ << '"';
+}
+
+void RankingSink::writeJsonString( std::string_view word )
+{
+	// Quoted, escaping quotes, backslashes and control characters.
+	this->out_ << '"';
+	for( char c : word )
+	{
+		if( c == '"' || c == '\\' )
+			this->out_ << '\\' << c;
+		else if( static_cast< unsigned char >( c ) < 0x20 )
+		{
+			char fill = this->out_.fill( '0' );
+			this->out_ << "\\u" << hex << setw( 4 ) << static_cast< unsigned >( c ) << dec;
+			this->out_.fill( fill );
+		}
+		else
+			this->out_ << c;
+	}
+	this->out_ << '"';
+}
@@ -0,0 +1,92 @@
+/**
+ * Definitions of RankingSink class - destination of words taken from a ranking, one at a
+ * time, in ranking order: printed to the console, or written as CSV rows or a JSON array.
+ *
+ * Words are written straight from their satellite data (no word is copied), so rankings
+ * can feed a file, a stream or another stage of a pipeline. Derived classes may override
+ * begin(), write() and end() to take words elsewhere.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef RANKINGSINK_H_
+#define RANKINGSINK_H_
+
+// Libraries:
+#include <ostream>
+#include <string_view>
+#include "AvlTreeNode.h"
+
+
+/**
+ * Enumerator to be used as argument to define how words are written.
+ *  CONSOLE Ranking's header, then a numbered line per word (as ranking commands print).
+ *  CSV     Header row, then "rank,word,score,frequency" per word.
+ *  JSON    Array of objects with rank, word, score and frequency.
+ */
+enum SinkFormat { CONSOLE, CSV, JSON };
+
+
+class RankingSink {
+public:
+	/**
+	 * Constructor: write words to a stream in a given format.
+	 *  @param out Output stream (must outlive the sink).
+	 *  @param format Output format.
+	 *  @param rank_digits Minimum digits of each rank, zero-padded (CONSOLE only).
+	 */
+	RankingSink( std::ostream &out, SinkFormat format = SinkFormat::CONSOLE, unsigned rank_digits = 1 );
+
+	/**
+	 * Destructor.
+	 */
+	virtual ~RankingSink();
+
+	/**
+	 * Start a ranking (header line, CSV header row, or JSON array's opening).
+	 *  @param order Sorting order of ranking's keys.
+	 */
+	virtual void begin( SortBy order );
+
+	/**
+	 * Write next word of the ranking, numbered from 1 since begin().
+	 *  @param data Word's satellite data.
+	 */
+	virtual void write( StringHashData *data );
+
+	/**
+	 * Finish a ranking (JSON array's closing; nothing otherwise).
+	 */
+	virtual void end();
+
+	/**
+	 * Get amount of words written since begin().
+	 *  @return Amount of words.
+	 */
+	unsigned getWrittenAmount() const;
+
+protected:
+	/**
+	 * Write a word as a CSV field (quoted if it has commas, quotes or line breaks).
+	 *  @param word Word.
+	 */
+	void writeCsvField( std::string_view word );
+
+	/**
+	 * Write a word as a JSON string (quoted, with quotes, backslashes and control
+	 * characters escaped).
+	 *  @param word Word.
+	 */
+	void writeJsonString( std::string_view word );
+
+
+// Attributes:
+	std::ostream &out_;     // Output stream.
+	SinkFormat format_;     // Output format.
+	unsigned rank_digits_;  // Minimum digits of each rank (CONSOLE).
+	unsigned written_;      // Words written since begin().
+};
+
+#endif /* RANKINGSINK_H_ */
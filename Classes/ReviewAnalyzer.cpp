@@ -12,19 +12,46 @@
 #include <fstream>
 #include <sstream>
 #include <locale>
-#include <stack>
+#include <cctype>
 #include <cmath>
+#include <limits>
+#include <algorithm>
 #include "ReviewAnalyzer.h"
+#include "CardinalityEstimator.h"
 
 using namespace std;
 
 
-ReviewAnalyzer::ReviewAnalyzer( unsigned hash_size )
+// Bytes read from the start of a reviews' file to estimate its vocabulary.
+static const size_t SAMPLE_BYTES = 64 << 20;
+
+// Amount of words kept in heaps of most positive, most negative and most frequent words.
+static const unsigned TOP_KEYS_CAPACITY = 100;
+
+
+ReviewAnalyzer::ReviewAnalyzer( unsigned hash_size, bool index_positions, bool defer_ranking,
+		RankingIndex ranking_index )
 	: database_( hash_size ),   // Initialize hash table with given size.
 	  score_ranking_( SortBy::SCORE ),         // Sort AVL Tree by score.
 	  frequency_ranking_( SortBy::FREQUENCY ), // Sort AVL Tree by frequency.
-     stopwords_( 1000 )        // Initialize stopwords' hash table.
+	  frozen_score_ranking_( SortBy::SCORE ),
+	  frozen_frequency_ranking_( SortBy::FREQUENCY ),
+	  most_positive_( SortBy::SCORE, true, TOP_KEYS_CAPACITY ),
+	  most_negative_( SortBy::SCORE, false, TOP_KEYS_CAPACITY ),
+	  most_frequent_( SortBy::FREQUENCY, true, TOP_KEYS_CAPACITY ),
+     stopwords_( database_.getHasher() )  // Hash stopwords as words in database.
 {
+	// Record positions of words if requested.
+	this->index_positions_ = index_positions;
+
+	// Defer rankings if requested; there's nothing to rank yet.
+	this->defer_ranking_ = defer_ranking;
+	this->rankings_dirty_ = false;
+	this->support_index_dirty_ = false;
+
+	// Sorted arrays can't be updated word by word: they require deferred ranking.
+	this->ranking_index_ = defer_ranking ? ranking_index : RankingIndex::AVL_TREE;
+
 	// Read stopwords.
 	readStopwords( "stopwords.txt" );
 }
@@ -88,10 +115,13 @@ int ReviewAnalyzer::run()
 				cout << "Couldn't open file. Wrong file path or format." << endl;
 			else
 			{
-				cout << "Generating ranking of words...\n";
-
-				// Create frequency ranking tree.
-				rankFrequency();
+				// Update frequency ranking tree with words read (deferred rankings are built
+				// by the first command printing them).
+				if( !this->defer_ranking_ )
+				{
+					cout << "Generating ranking of words...\n";
+					rankFrequency();
+				}
 
 				cout << "Success." << endl;
 			}
@@ -125,6 +155,17 @@ int ReviewAnalyzer::run()
 			// If no argument was provided, print message.
 			if( word.empty() )
 				cout << "Command requires argument. Enter \"help\" to list commands." << endl;
+			// If argument is quoted, call "getr" command for a phrase.
+			else if( word.front() == '\"' )
+			{
+				// Remove quotes.
+				string phrase = word.substr( 1, word.find( '\"', 1 ) - 1 );
+
+				if( !getPhraseReviews( phrase ) )
+					cout << "There's no occurrence of \"" << phrase << "\" in our database." << endl;
+				else
+					cout << "Success." << endl;
+			}
 			// Otherwise, call "getr" command.
 			else if( !getReviews( word ) )
 				cout << "There's no occurrence of \"" << word << "\" in our database." << endl;
@@ -149,11 +190,69 @@ int ReviewAnalyzer::run()
 				cout << "There's no word starting with \"" << prefix << "\" in our database." << endl;
 		}
 
+		// If command is "rank".
+		else if( command == "rank" )
+		{
+			// Read argument (word).
+			string word = readArgument();
+
+			// Change word to lowercase.
+			changeToLowercase( word );
+
+			// If no argument was provided, print message.
+			if( word.empty() )
+				cout << "Command requires argument. Enter \"help\" to list commands." << endl;
+			// Otherwise, call "rank" command.
+			else if( !printRank( word ) )
+				cout << "There's no occurrence of \"" << word << "\" in our database." << endl;
+		}
+
+		// If command is "range":
+		else if( command == "range" )
+		{
+			// Read arguments: keys, lowest key, optionally greatest key, then optional
+			// direction and format.
+			istringstream arguments( readArgument() );
+			string keys, option;
+			double low, high = numeric_limits< double >::infinity();
+			bool descending = true;
+			SinkFormat format = SinkFormat::CONSOLE;
+			bool is_valid = static_cast< bool >( arguments >> keys >> low );
+			if( is_valid && !( arguments >> high ) )
+			{
+				high = numeric_limits< double >::infinity();
+				arguments.clear();
+			}
+			while( is_valid && arguments >> option )
+			{
+				changeToLowercase( option );
+				if( option == "asc" || option == "desc" )
+					descending = ( option == "desc" );
+				else if( option == "csv" || option == "json" )
+					format = ( option == "csv" ) ? SinkFormat::CSV : SinkFormat::JSON;
+				else
+					is_valid = false;
+			}
+			changeToLowercase( keys );
+
+			// Keys must be scores or frequencies.
+			if( !is_valid || ( keys != "score" && keys != "frequency" ) )
+				cout << "Invalid argument. Enter \"help\" to list commands." << endl;
+			else if( this->database_.getUsedAmount() == 0 )
+				cout << "Database is empty." << endl;
+			// Call "range" command.
+			else if( !printRange( keys == "score" ? SortBy::SCORE : SortBy::FREQUENCY,
+					low, high, descending, format ) )
+				cout << "There's no word in range." << endl;
+		}
+
 		// If command is "print+":
 		else if( command == "print+" )
 		{
-			// Read argument (ranking size).
+			// Read argument (ranking size, optionally followed by "minfreq <frequency>").
 			string rank_size = readArgument();
+			unsigned min_frequency = 0;
+			bool is_valid = splitMinFrequency( rank_size, min_frequency );
 
 			// If no argument was provided, print message.
 			if( rank_size.empty() )
@@ -169,14 +268,14 @@ int ReviewAnalyzer::run()
 				{
 					++i;
 				}
-				if( i < rank_size.size() )
+				if( i < rank_size.size() || !is_valid )
 					cout << "Invalid argument. Enter \"help\" to list commands." << endl;
 
 				// Argument is valid:
-				else if( !this->score_ranking_.isEmpty() )
+				else if( this->database_.getUsedAmount() > 0 )
 				{
 					// Call "print+" command.
-					printMostPositive( stoi( rank_size ) );
+					printMostPositive( stoi( rank_size ), min_frequency );
 				}
 				else
 					cout << "Database is empty." << endl;
@@ -186,8 +285,10 @@ int ReviewAnalyzer::run()
 		// If command is "print-":
 		else if( command == "print-" )
 		{
-			// Read argument (ranking size).
+			// Read argument (ranking size, optionally followed by "minfreq <frequency>").
 			string rank_size = readArgument();
+			unsigned min_frequency = 0;
+			bool is_valid = splitMinFrequency( rank_size, min_frequency );
 
 			// If no argument was provided, print message.
 			if( rank_size.empty() )
@@ -203,14 +304,14 @@ int ReviewAnalyzer::run()
 				{
 					++i;
 				}
-				if( i < rank_size.size() )
+				if( i < rank_size.size() || !is_valid )
 					cout << "Invalid argument. Enter \"help\" to list commands." << endl;
 
 				// Argument is valid:
-				else if( !this->score_ranking_.isEmpty() )
+				else if( this->database_.getUsedAmount() > 0 )
 				{
 					// Call "print-" command.
-					printMostNegative( stoi( rank_size ) );
+					printMostNegative( stoi( rank_size ), min_frequency );
 				}
 				else
 					cout << "Database is empty." << endl;
@@ -241,7 +342,7 @@ int ReviewAnalyzer::run()
 					cout << "Invalid argument. Enter \"help\" to list commands." << endl;
 
 				// Argument is valid:
-				else if( !this->score_ranking_.isEmpty() )
+				else if( this->database_.getUsedAmount() > 0 )
 				{
 					// Call "printf" command.
 					printMostFrequent( stoi( rank_size ) );
@@ -251,6 +352,26 @@ int ReviewAnalyzer::run()
 			}
 		}
 
+		// If command is "stats":
+		else if( command == "stats" )
+		{
+			// Read optional argument (output format).
+			string format;
+			if( cin.peek() == '\n' )
+				cin.ignore();
+			else
+				format = readArgument();
+
+			// Change format to lowercase.
+			changeToLowercase( format );
+
+			// Call "stats" command, in text or JSON.
+			if( format.empty() || format == "json" )
+				printStats( format == "json" );
+			else
+				cout << "Invalid argument. Enter \"help\" to list commands." << endl;
+		}
+
 		// If command is "exit" or "quit":
 		else if( command == "exit" || command == "quit" )
 		{
@@ -287,6 +408,7 @@ std::string ReviewAnalyzer::readCommand()
 	if( command == "analyze" || command == "help" || command == "read" ||
 			command == "print+" || command == "print-" || command == "printf" ||
 			command == "analyzef" || command == "getr" || command == "search" ||
+			command == "rank" || command == "range" || command == "stats" ||
 			command == "exit" || command == "quit" )
 	{
 		// Command is valid.
@@ -343,8 +465,16 @@ void ReviewAnalyzer::printCommands()
 			<< "search    <prefix>    : search for words starting with <prefix>\n"
 			<< "print+    <amount>    : print <amount> most positive words in database\n"
 			<< "print-    <amount>    : print <amount> most negative words in database\n"
+			<< "print+    <amount> minfreq <f>\n"
+			<< "print-    <amount> minfreq <f>\n"
+			<< "                      : same, among words seen at least <f> times\n"
 			<< "printf    <amount>    : print <amount> most frequent words in database\n"
 			<< "getr      <word>      : create file listing all reviews where <word> appears\n"
+			<< "getr      \"<phrase>\"  : create file listing all reviews where <phrase> appears\n"
+			<< "rank      <word>      : print <word>'s position in score and frequency rankings\n"
+			<< "range     score|frequency <min> [max] [asc|desc] [csv|json]\n"
+			<< "                      : print words with keys in [<min>, <max>] (greatest first)\n"
+			<< "stats     [json]      : print hash tables' statistics (optionally as JSON)\n"
 			<< "help                  : print list of commands\n"
 			<< "exit                  : ends program\n"
 			<< "--  End of list  --"
@@ -375,6 +505,9 @@ bool ReviewAnalyzer::readFile( std::string file_name )
 	if( !file.is_open() )
 		return false;
 
+	// Presize database for the estimated vocabulary, so a big file rehashes it once at most.
+	this->database_.reserve( this->database_.getUsedAmount() + estimateVocabulary( file ) );
+
 	// Print message.
 	cout << "Reading file..." << endl;
 
@@ -413,29 +546,34 @@ bool ReviewAnalyzer::readFile( std::string file_name )
 		//if( review.back() == '\t' )
 		//	review.pop_back();  // Ignore '\t' in string.
 
-		// Words from review.
-		string word;
-		// Key for word in database.
-		unsigned key;
-		// Stream to get each word.
-		istringstream line( review );
+		// Lowercase copy of review, whose words are viewed without copying them.
+		string text( review );
+		changeToLowercase( text );
+
+		// Word from review.
+		string_view word;
+		// Position of next word in text.
+		size_t position = 0;
+		// Position of word's token among review's tokens (filtered ones count too, so
+		// phrases keep their gaps).
+		unsigned token = 0;
 
 		// Insert each word in database and update scores accordingly.
-		while( !line.eof() )
+		for( ; nextWord( text, position, word ); ++token )
 		{
-			// Get word.
-			line >> word;
+			// Word's hash value, calculated only once.
+			uint64_t hash_value = this->database_.hashOf( word );
 
-			// Change word to lowercase.
-			changeToLowercase( word );
-
-			// Filter punctuation characters and concatenated words.
-			if( !word.empty() && filterWord( word ) )
+			// Filter punctuation characters and stopwords.
+			if( filterWord( word, hash_value ) )
 			{
-				// Insert word and get its key.
-				insert( word, score, index, &key );
-				// Update word's score.
-				updateScore( getSatelliteData( key ), index, score );
+				// Insert word (or count this occurrence) and get its key.
+				unsigned key;
+				insert( word, hash_value, score, index, &key );
+
+				// Record where word is in review.
+				if( this->index_positions_ )
+					getSatelliteData( key )->addPosition( index, token );
 			}
 		}
 	}
@@ -449,26 +587,25 @@ bool ReviewAnalyzer::readFile( std::string file_name )
 
 bool ReviewAnalyzer::analyze( std::string review, double *score, bool print )
 {
-	// Stream to get each word from the text.
-	istringstream text( review );
+	// Lowercase copy of text, whose words are viewed without copying them.
+	string text( review );
+	changeToLowercase( text );
 
-	string word; 	// Words from the text.
-	unsigned key;  // Key to word in database.
+	string_view word;    // Words from the text.
+	size_t position = 0; // Position of next word in text.
+	unsigned key;        // Key to word in database.
 	unsigned words_amount = 0;  // Amount of words for the score.
 	double review_score = 0;    // Score of review.
 	bool has_word = false;		 // Indicate a word has been found in database.
 
 	// Read the entire text word by word.
-	while( !text.eof() )
+	while( nextWord( text, position, word ) )
 	{
-		// Get a word.
-		text >> word;
-
-		// Change word to lowercase.
-		changeToLowercase( word );
+		// Word's hash value, calculated only once.
+		uint64_t hash_value = this->database_.hashOf( word );
 
 		// If it passes by the filter and it is in the database:
-		if( filterWord( word ) && search( word, &key ) )
+		if( filterWord( word, hash_value ) && this->database_.search( word, hash_value, &key ) )
 		{
 			// Indicate so.
 			has_word = true;
@@ -615,11 +752,29 @@ bool ReviewAnalyzer::analyzeFile( std::string file_name, bool print )
 
 bool ReviewAnalyzer::insert( std::string word, double phrase_score, unsigned index, unsigned *key )
 {
-	// Insert word in Trie Tree to search for prefix.
-	this->words_.insert( word );
+	// Hash word, then insert it as readFile() does.
+	return insert( word, this->database_.hashOf( word ), phrase_score, index, key );
+}
+
+bool ReviewAnalyzer::insert( std::string_view word, uint64_t hash_value, double phrase_score,
+		unsigned index, unsigned *key )
+{
+	// Find or insert word and get its key.
+	bool is_inserted;
+	unsigned word_key = this->database_.findOrInsert( word, hash_value, phrase_score, index, &is_inserted );
+
+	// Insert new words in Trie Tree to search for prefix.
+	if( is_inserted )
+		this->words_.insert( string( word ) );
 
-	// Insert word in database.
-	return this->database_.insert( word, phrase_score, index, key );
+	// Update word's score, rankings and heaps (a new word already counts this occurrence).
+	updateScore( getSatelliteData( word_key ), index, is_inserted ? -1.0 : phrase_score );
+
+	// Give word's key, if requested.
+	if( key != nullptr )
+		*key = word_key;
+
+	return is_inserted;
 }
 
 bool ReviewAnalyzer::search( std::string word, unsigned *key )
@@ -633,28 +788,103 @@ bool ReviewAnalyzer::search( std::string word, unsigned *key )
 
 void ReviewAnalyzer::remove( std::string word )
 {
+	// Change word to lowercase.
+	changeToLowercase( word );
+
+	// Key to word in database.
+	unsigned key;
+
+	// Remove word from rankings first: its satellite data is released by the database
+	// and may be reused by another word. Outdated rankings are rebuilt without it anyway
+	// (and their keys may no longer match its data), and so are sorted arrays.
+	if( this->database_.search( word, &key ) )
+	{
+		StringHashData *satellite_data = this->database_.getData( key );
+
+		this->most_positive_.remove( satellite_data );
+		this->most_negative_.remove( satellite_data );
+		this->most_frequent_.remove( satellite_data );
+		this->support_index_dirty_ = true;
+
+		if( this->ranking_index_ == RankingIndex::SORTED_ARRAY )
+			this->rankings_dirty_ = true;
+		else if( !this->rankings_dirty_ )
+		{
+			if( this->score_ranking_.search( satellite_data ) )
+				this->score_ranking_.remove( satellite_data );
+
+			// Eager frequency ranking holds words under the frequency they were ranked with.
+			if( !this->defer_ranking_ )
+			{
+				uint32_t id = satellite_data->getWordId();
+				if( id < this->ranked_frequencies_.size() && this->ranked_frequencies_[ id ] > 0 )
+				{
+					this->frequency_ranking_.remove( satellite_data, this->ranked_frequencies_[ id ] );
+					this->ranked_frequencies_[ id ] = 0;
+				}
+			}
+			else if( this->frequency_ranking_.search( satellite_data ) )
+				this->frequency_ranking_.remove( satellite_data );
+		}
+	}
+
 	// Remove word from database.
 	this->database_.remove( word );
 }
 
-void ReviewAnalyzer::printMostPositive( unsigned rank_size )
+void ReviewAnalyzer::printMostPositive( unsigned rank_size, unsigned min_frequency )
 {
-	// Print rank_size most positive words.
-	this->score_ranking_.printGreatestKeys( rank_size );
+	// Words seen at least min_frequency times come from the score and frequency index.
+	if( min_frequency > 1 )
+		printSupportRanking( rank_size, min_frequency, true );
+
+	// Print rank_size most positive words, from their heap if it knows them.
+	else if( !this->most_positive_.printKeys( rank_size ) )
+	{
+		// Otherwise, from the full ranking, which refills the heap.
+		rankWords();
+		if( this->ranking_index_ == RankingIndex::SORTED_ARRAY )
+			this->frozen_score_ranking_.printGreatestKeys( rank_size );
+		else
+			this->score_ranking_.printGreatestKeys( rank_size );
+		refillTopKeys( this->most_positive_ );
+	}
 	cout << "--  End of ranking   --" << endl;
 }
 
-void ReviewAnalyzer::printMostNegative( unsigned rank_size )
+void ReviewAnalyzer::printMostNegative( unsigned rank_size, unsigned min_frequency )
 {
-	// Print rank_size most positive words.
-	this->score_ranking_.printLowestKeys( rank_size );
+	// Words seen at least min_frequency times come from the score and frequency index.
+	if( min_frequency > 1 )
+		printSupportRanking( rank_size, min_frequency, false );
+
+	// Print rank_size most negative words, from their heap if it knows them.
+	else if( !this->most_negative_.printKeys( rank_size ) )
+	{
+		// Otherwise, from the full ranking, which refills the heap.
+		rankWords();
+		if( this->ranking_index_ == RankingIndex::SORTED_ARRAY )
+			this->frozen_score_ranking_.printLowestKeys( rank_size );
+		else
+			this->score_ranking_.printLowestKeys( rank_size );
+		refillTopKeys( this->most_negative_ );
+	}
 	cout << "--  End of ranking   --" << endl;
 }
 
 void ReviewAnalyzer::printMostFrequent( unsigned rank_size )
 {
-	// Print rank_size most frequent words.
-	this->frequency_ranking_.printGreatestKeys( rank_size );
+	// Print rank_size most frequent words, from their heap if it knows them.
+	if( !this->most_frequent_.printKeys( rank_size ) )
+	{
+		// Otherwise, from the full ranking, which refills the heap.
+		rankWords();
+		if( this->ranking_index_ == RankingIndex::SORTED_ARRAY )
+			this->frozen_frequency_ranking_.printGreatestKeys( rank_size );
+		else
+			this->frequency_ranking_.printGreatestKeys( rank_size );
+		refillTopKeys( this->most_frequent_ );
+	}
 	cout << "--  End of ranking   --" << endl;
 }
 
@@ -682,8 +912,8 @@ bool ReviewAnalyzer::getReviews( std::string word )
 				<< fixed << setprecision( 2 )
 				<< "Score: " << word_data->getScore() << '\n' << endl;
 
-		// Word's reviews.
-		vector< unsigned > indexes = word_data->getIndexes();
+		// Word's reviews, decoded while iterating.
+		const PostingList &indexes = word_data->getIndexes();
 
 		// Output each review where word appears to file.
 		for( auto index : indexes )
@@ -702,19 +932,339 @@ bool ReviewAnalyzer::getReviews( std::string word )
 	return false;
 }
 
+bool ReviewAnalyzer::getPhraseReviews( std::string phrase )
+{
+	// Change phrase to lowercase.
+	changeToLowercase( phrase );
+
+	// Words of phrase kept in database: offset in phrase and reviews where each one appears.
+	vector< pair< unsigned, const PostingList* > > terms;
+	// Filtered words of phrase: offset in phrase and word.
+	vector< pair< unsigned, string_view > > filtered;
+	// Phrase's words joined by '_' (characters other than letters and digits replaced),
+	// for file's name.
+	string file_name;
+
+	// Word from phrase.
+	string_view word;
+	// Position of next word in phrase.
+	size_t position = 0;
+
+	// Offset of each word in phrase (filtered words count too, matching any token).
+	for( unsigned offset = 0; nextWord( phrase, position, word ); ++offset )
+	{
+		for( char letter : word )
+			file_name.push_back( isalnum( static_cast< unsigned char >( letter ) ) ? letter : '_' );
+		file_name.push_back( '_' );
+
+		uint64_t hash_value = this->database_.hashOf( word );
+		if( filterWord( word, hash_value ) )
+		{
+			// A word missing from database means no review has the phrase.
+			unsigned key;
+			if( !this->database_.search( word, hash_value, &key ) )
+				return false;
+
+			terms.emplace_back( offset, &getSatelliteData( key )->getIndexes() );
+		}
+		else
+			filtered.emplace_back( offset, word );
+	}
+
+	// Phrase made only of filtered words can't be searched.
+	if( terms.empty() )
+		return false;
+
+	// Rarest word first: only its reviews are candidates.
+	sort( terms.begin(), terms.end(),
+			[]( const pair< unsigned, const PostingList* > &a, const pair< unsigned, const PostingList* > &b )
+			{ return a.second->size() < b.second->size(); } );
+
+	// Reviews where phrase appears.
+	vector< unsigned > indexes = matchPhrase( terms, filtered );
+	if( indexes.empty() )
+		return false;
+
+	// Print message.
+	cout << "Listing reviews..." << endl;
+
+	// Output file.
+	ofstream file( "Files/" + file_name + "reviews.csv" );
+
+	// Output phrase and amount of reviews.
+	file << "Phrase: " << phrase << '\n'
+			<< "Reviews: " << indexes.size() << '\n' << endl;
+
+	// Output each review where phrase appears to file.
+	for( auto index : indexes )
+		file << this->reviews_.at( index ).first << ' ' << this->reviews_.at( index ).second << endl;
+
+	file.close();
+	return true;
+}
+
+std::vector< unsigned > ReviewAnalyzer::matchPhrase(
+		const std::vector< std::pair< unsigned, const PostingList* > > &terms,
+		const std::vector< std::pair< unsigned, std::string_view > > &filtered )
+{
+	// Reviews where phrase appears.
+	vector< unsigned > indexes;
+
+	// One iterator per word, all of them moving forward through increasing indexes.
+	vector< PostingList::Iterator > cursors;
+	for( auto &term : terms )
+		cursors.push_back( term.second->begin() );
+
+	// Positions of each word in candidate review (reused, so they're allocated once).
+	vector< vector< unsigned > > positions( terms.size() );
+
+	// Each review of rarest word is a candidate.
+	for( ; cursors[ 0 ] != terms[ 0 ].second->end(); ++cursors[ 0 ] )
+	{
+		unsigned index = *cursors[ 0 ];
+
+		// Move every other word to candidate review; it must appear there as well.
+		bool has_all = true;
+		bool has_positions = cursors[ 0 ].hasPositions();
+		for( unsigned t = 1; t < terms.size() && has_all; ++t )
+		{
+			while( cursors[ t ] != terms[ t ].second->end() && *cursors[ t ] < index )
+				++cursors[ t ];
+
+			has_all = cursors[ t ] != terms[ t ].second->end() && *cursors[ t ] == index;
+			has_positions = has_positions && has_all && cursors[ t ].hasPositions();
+		}
+
+		if( !has_all )
+			continue;
+
+		// Without positions, a review with every word is a match.
+		if( !has_positions )
+		{
+			indexes.push_back( index );
+			continue;
+		}
+
+		for( unsigned t = 0; t < terms.size(); ++t )
+			cursors[ t ].getPositions( positions[ t ] );
+
+		// Phrase starts at each position of rarest word minus its offset; every other word
+		// must be at its own offset from there.
+		bool is_found = false;
+		for( unsigned i = 0; i < positions[ 0 ].size() && !is_found; ++i )
+		{
+			if( positions[ 0 ][ i ] < terms[ 0 ].first )
+				continue;
+			unsigned start = positions[ 0 ][ i ] - terms[ 0 ].first;
+
+			is_found = true;
+			for( unsigned t = 1; t < terms.size() && is_found; ++t )
+				is_found = find( positions[ t ].begin(), positions[ t ].end(),
+						start + terms[ t ].first ) != positions[ t ].end();
+
+			// Filtered words are compared with review's text only now.
+			is_found = is_found && hasWordsAt( index, start, filtered );
+		}
+
+		if( is_found )
+			indexes.push_back( index );
+	}
+
+	return indexes;
+}
+
+bool ReviewAnalyzer::hasWordsAt( unsigned index, unsigned start,
+		const std::vector< std::pair< unsigned, std::string_view > > &words )
+{
+	// No words to compare.
+	if( words.empty() )
+		return true;
+
+	// Lowercase copy of review, as its words were inserted.
+	string text( this->reviews_.at( index ).second );
+	changeToLowercase( text );
+
+	// Word from review.
+	string_view word;
+	// Position of next word in text.
+	size_t position = 0;
+	// Next word to compare.
+	unsigned w = 0;
+
+	// Compare each word with the token at its offset from start.
+	for( unsigned token = 0; w < words.size() && nextWord( text, position, word ); ++token )
+		if( token == start + words[ w ].first )
+		{
+			if( word != words[ w ].second )
+				return false;
+			++w;
+		}
+
+	// Review may have ended before every word was compared.
+	return w == words.size();
+}
+
 bool ReviewAnalyzer::searchWords( std::string word )
 {
 	// Search for word, printing words found.
 	return this->words_.search( word );
 }
 
+bool ReviewAnalyzer::printRank( std::string word )
+{
+	// Key to word in database.
+	unsigned key;
+
+	// Word must be in database.
+	if( !this->database_.search( word, &key ) )
+		return false;
+
+	// Rankings must be up to date.
+	rankWords();
+	StringHashData *satellite_data = getSatelliteData( key );
+
+	// Position and percentile of word in each ranking (O(log n) each).
+	unsigned score_rank, frequency_rank, size;
+	double score_percentile, frequency_percentile;
+	if( this->ranking_index_ == RankingIndex::SORTED_ARRAY )
+	{
+		score_rank = this->frozen_score_ranking_.getRank( satellite_data );
+		frequency_rank = this->frozen_frequency_ranking_.getRank( satellite_data );
+		size = this->frozen_score_ranking_.getSize();
+		score_percentile = this->frozen_score_ranking_.getPercentile( satellite_data->getScore() );
+		frequency_percentile = this->frozen_frequency_ranking_.getPercentile( satellite_data->getFrequency() );
+	}
+	else
+	{
+		score_rank = this->score_ranking_.getRank( satellite_data );
+		frequency_rank = this->frequency_ranking_.getRank( satellite_data );
+		size = this->score_ranking_.getSize();
+		score_percentile = this->score_ranking_.getPercentile( satellite_data->getScore() );
+		frequency_percentile = this->frequency_ranking_.getPercentile( satellite_data->getFrequency() );
+	}
+
+	// Rank 0 means word isn't ranked: no position to print, as if it weren't found.
+	if( score_rank == 0 || frequency_rank == 0 )
+		return false;
+
+	cout << '\"' << word << "\":\n"
+			<< fixed << setprecision( 2 ) << setfill( ' ' )
+			<< "  score     " << setw( 8 ) << satellite_data->getScore()
+			<< " : rank " << score_rank << " of " << size
+			<< ", percentile " << score_percentile << '\n'
+			<< "  frequency " << setw( 8 ) << satellite_data->getFrequency()
+			<< " : rank " << frequency_rank << " of " << size
+			<< ", percentile " << frequency_percentile
+			<< endl;
+
+	return true;
+}
+
+bool ReviewAnalyzer::printRange( SortBy order, double low, double high, bool descending,
+		SinkFormat format )
+{
+	// Empty range has no words.
+	if( low > high )
+		return false;
+
+	// Rankings must be up to date.
+	rankWords();
+
+	// Amount of words in range (to number them with as many digits), in O(log n).
+	unsigned amount;
+	if( this->ranking_index_ == RankingIndex::SORTED_ARRAY )
+	{
+		const FrozenRanking &ranking = ( order == SortBy::SCORE ) ?
+				this->frozen_score_ranking_ : this->frozen_frequency_ranking_;
+		amount = ranking.getSize() - ranking.countLowerKeys( low ) - ranking.countGreaterKeys( high );
+	}
+	else
+	{
+		AvlTree &ranking = ( order == SortBy::SCORE ) ? this->score_ranking_ : this->frequency_ranking_;
+		amount = ranking.getSize() - ranking.countLowerKeys( low ) - ranking.countGreaterKeys( high );
+	}
+	if( amount == 0 )
+		return false;
+
+	unsigned digits_amount = 0;
+	for( unsigned size = amount; size > 0; size /= 10 )
+		++digits_amount;
+
+	// Write words straight from the ranking (scores with default notation).
+	cout << defaultfloat << setprecision( 6 );
+	RankingSink sink( cout, format, digits_amount );
+	if( this->ranking_index_ == RankingIndex::SORTED_ARRAY )
+		( order == SortBy::SCORE ? this->frozen_score_ranking_ : this->frozen_frequency_ranking_ )
+				.writeRange( sink, low, high, descending );
+	else
+		( order == SortBy::SCORE ? this->score_ranking_ : this->frequency_ranking_ )
+				.writeRange( sink, low, high, descending );
+
+	if( format == SinkFormat::CONSOLE )
+		cout << "--  End of ranking   --" << endl;
+	else
+		cout.flush();
+
+	return true;
+}
+
+void ReviewAnalyzer::printStats( bool json )
+{
+	// Counters of both hash tables.
+	HashTableStats database = this->database_.getStats();
+	HashTableStats stopwords = this->stopwords_.getStats();
+
+	// Print them as a single JSON object, one member per table.
+	if( json )
+	{
+		cout << "{\"database\":";
+		database.printJson( cout );
+		cout << ",\"stopwords\":";
+		stopwords.printJson( cout );
+		cout << '}' << endl;
+	}
+
+	// Otherwise, print them as text.
+	else
+	{
+		database.print( cout, "database" );
+		stopwords.print( cout, "stopwords" );
+		cout << "--  End of statistics  --" << endl;
+	}
+}
+
 StringHashData* ReviewAnalyzer::getSatelliteData( unsigned key )
 {
 	// Return data at position key.
 	return this->database_.getData( key );
 }
 
-bool ReviewAnalyzer::filterWord( std::string &word )
+bool ReviewAnalyzer::nextWord( const std::string &text, std::size_t &position, std::string_view &word )
+{
+	// Whitespace characters separating words.
+	const char *whitespace = " \t\r\n";
+
+	// Find word's first character.
+	size_t begin = text.find_first_not_of( whitespace, position );
+	if( begin == string::npos )
+	{
+		position = text.size();
+		return false;
+	}
+
+	// Find first character after word.
+	size_t end = text.find_first_of( whitespace, begin );
+	if( end == string::npos )
+		end = text.size();
+
+	// View word's characters and continue after it next time.
+	word = string_view( text ).substr( begin, end - begin );
+	position = end;
+
+	return true;
+}
+
+bool ReviewAnalyzer::filterWord( std::string_view word, uint64_t hash_value )
 {
 	// If word is a punctuation mark, it can't be inserted.
 	if( word.empty() || word.at( 0 ) == '.' || word.at( 0 ) == ',' || word.at( 0 ) == ';' ||
@@ -730,13 +1280,77 @@ bool ReviewAnalyzer::filterWord( std::string &word )
 		return false;
 	}
 	// If word is a stopword, it can't be inserted.
-	else if( isStopword( word ) )
+	else if( isStopword( word, hash_value ) )
 		return false;
 
 	// Otherwise, it can be inserted.
 	return true;
 }
 
+unsigned ReviewAnalyzer::estimateVocabulary( std::istream &file )
+{
+	// File's size, to extrapolate from the sample.
+	file.seekg( 0, ios::end );
+	double file_bytes = static_cast< double >( file.tellg() );
+	file.seekg( 0, ios::beg );
+
+	// Sample's size: the whole file if it's small.
+	double sample_bytes = min( file_bytes, static_cast< double >( SAMPLE_BYTES ) );
+
+	// Distinct words seen so far.
+	CardinalityEstimator vocabulary;
+	// Distinct words and bytes read by the first half of the sample.
+	double half_words = 0.0, half_bytes = 0.0;
+	// Bytes read.
+	double read_bytes = 0.0;
+
+	// Count words of each line as readFile() would insert them, until sample is read.
+	string line;
+	while( read_bytes < sample_bytes && getline( file, line ) )
+	{
+		read_bytes += line.size() + 1;
+		changeToLowercase( line );
+
+		string_view word;
+		size_t position = 0;
+		while( nextWord( line, position, word ) )
+		{
+			uint64_t hash_value = this->database_.hashOf( word );
+			if( filterWord( word, hash_value ) )
+				vocabulary.add( hash_value );
+		}
+
+		// Keep first half's estimate, to measure how fast vocabulary grows.
+		if( half_bytes == 0.0 && read_bytes >= sample_bytes / 2 )
+		{
+			half_words = vocabulary.estimate();
+			half_bytes = read_bytes;
+		}
+	}
+
+	// Rewind file for reading.
+	file.clear();
+	file.seekg( 0, ios::beg );
+
+	double words = vocabulary.estimate();
+
+	// Rest of the file: vocabulary grows as ( text size )^beta, beta usually about 0.5
+	// for natural language; it's measured between the sample's halves, kept in [0.4, 1.0].
+	if( read_bytes < file_bytes && read_bytes > 0.0 )
+	{
+		double beta = 0.5;
+		if( half_words > 0.0 && words > half_words && read_bytes > half_bytes )
+			beta = log( words / half_words ) / log( read_bytes / half_bytes );
+		beta = min( max( beta, 0.4 ), 1.0 );
+
+		words *= pow( file_bytes / read_bytes, beta );
+	}
+
+	// Keep estimate in a range any table can be sized for.
+	return static_cast< unsigned >( min( ceil( words ),
+			static_cast< double >( numeric_limits< unsigned >::max() / 2 ) ) );
+}
+
 bool ReviewAnalyzer::readStopwords( std::string file_name )
 {
 	// Add ".txt" to file_name if client didn't provide it.
@@ -757,28 +1371,24 @@ bool ReviewAnalyzer::readStopwords( std::string file_name )
 
 	// Stopword to be filtered.
 	string stopword;
+	// Every stopword in file.
+	vector< string > stopwords;
 
-	// Read entire file, line by line.
-	while( !file.eof() )
-	{
-		// Read review.
-		file >> stopword;
-
-		// Insert it in hash table.
-		this->stopwords_.insert( stopword, 0, 0 );
-	}
+	// Read entire file, word by word.
+	while( file >> stopword )
+		stopwords.push_back( stopword );
 
 	// Close file.
 	file.close();
 
-	// File was successfully read.
-	return true;
+	// Build perfect hash set of stopwords.
+	return this->stopwords_.build( stopwords );
 }
 
-bool ReviewAnalyzer::isStopword( std::string word )
+bool ReviewAnalyzer::isStopword( std::string_view word, uint64_t hash_value )
 {
-	// Search for word in stopword hash table.
-	return this->stopwords_.search( word );
+	// Search for word in stopwords' set.
+	return this->stopwords_.contains( word, hash_value );
 }
 
 unsigned ReviewAnalyzer::storeReview( std::string review, unsigned score )
@@ -795,6 +1405,27 @@ unsigned ReviewAnalyzer::storeReview( std::string review, unsigned score )
 
 void ReviewAnalyzer::updateScore( StringHashData *satellite_data, unsigned index, double new_score )
 {
+	// Score and frequency index is rebuilt when next needed.
+	this->support_index_dirty_ = true;
+
+	// Deferred rankings: only count occurrence, rankings are rebuilt when needed.
+	if( this->defer_ranking_ )
+	{
+		if( new_score >= 0.0 )
+			satellite_data->recalculateScore( new_score, index );
+		this->rankings_dirty_ = true;
+		updateTopKeys( satellite_data );
+		return;
+	}
+
+	// Frequency ranking is updated by rankFrequency(): list each new word, and each word
+	// still ranked under its current frequency (words already listed have another one).
+	uint32_t id = satellite_data->getWordId();
+	if( id >= this->ranked_frequencies_.size() )
+		this->ranked_frequencies_.resize( id + 1, 0 );
+	if( new_score < 0.0 || this->ranked_frequencies_[ id ] == satellite_data->getFrequency() )
+		this->frequency_changes_.push_back( satellite_data );
+
 	// If new_score is negative (standard argument), satellite_data isn't in the tree
 	// and must be inserted.
 	if( new_score < 0.0 )
@@ -812,54 +1443,165 @@ void ReviewAnalyzer::updateScore( StringHashData *satellite_data, unsigned index
 	// so insert it.
 	else
 		this->score_ranking_.insert( satellite_data );
+
+	// Heaps of strongest words follow every change.
+	updateTopKeys( satellite_data );
 }
 
 bool ReviewAnalyzer::rankFrequency()
 {
-	// Insert each word in frequency tree.
-	AvlTreeNode *root = this->score_ranking_.getRoot();
+	// Move each word read since last update to its current frequency: loading a file costs
+	// as many tree updates as distinct words in it, not as words in database.
+	for( auto satellite_data : this->frequency_changes_ )
+	{
+		// Skip removed words (already out of the ranking) and words already moved (a key
+		// reused by a new word is listed twice).
+		uint32_t id = satellite_data->getWordId();
+		if( id == StringHashData::NO_WORD ||
+				this->ranked_frequencies_[ id ] == satellite_data->getFrequency() )
+			continue;
+
+		// Remove word from its previous place, if it was ranked, and insert it again.
+		if( this->ranked_frequencies_[ id ] > 0 )
+			this->frequency_ranking_.remove( satellite_data, this->ranked_frequencies_[ id ] );
+		this->frequency_ranking_.insert( satellite_data );
+		this->ranked_frequencies_[ id ] = satellite_data->getFrequency();
+	}
+	this->frequency_changes_.clear();
 
-	// Stack to traverse tree.
-	stack< AvlTreeNode* > traverse;
+	// Return whether there are any words ranked.
+	return !this->frequency_ranking_.isEmpty();
+}
 
-	// Push root to stack.
-	traverse.push( root );
+bool ReviewAnalyzer::rankWords()
+{
+	// Eager rankings: only frequency ranking may lag behind, by words read since its update.
+	if( !this->defer_ranking_ )
+		return rankFrequency();
 
-	// Last node checked.
-	AvlTreeNode *last = root;
+	// Rankings are up to date (always, unless they're deferred).
+	if( !this->rankings_dirty_ )
+		return ( this->ranking_index_ == RankingIndex::SORTED_ARRAY ) ?
+				!this->frozen_score_ranking_.isEmpty() : !this->score_ranking_.isEmpty();
 
-	// Traverse tree using left-right-center route:
-	while( !traverse.empty() )
+	// Gather every word in the database.
+	vector< StringHashData* > words;
+	getWords( words );
+
+	// Build both rankings from scratch, as trees or as sorted arrays.
+	if( this->ranking_index_ == RankingIndex::SORTED_ARRAY )
 	{
-		// Node's left descendant.
-		AvlTreeNode *left = traverse.top()->getLeftDescendant();
-		// Node's right descendant.
-		AvlTreeNode *right = traverse.top()->getRightDescendant();
+		this->frozen_score_ranking_.build( words );
+		this->frozen_frequency_ranking_.build( words );
+	}
+	else
+	{
+		this->score_ranking_.build( words );
+		this->frequency_ranking_.build( words );
+	}
+	this->rankings_dirty_ = false;
 
-		// If there's a left descendant that wasn't visited,
-		// push it to the stack.
-		if( left != nullptr && left != last && right != last )
-			traverse.push( left );
+	return !words.empty();
+}
 
-		// If there's a right descendant that wasn't visited,
-		// push it to the stack.
-		else if( right != nullptr && right != last )
-			traverse.push( right );
+void ReviewAnalyzer::getWords( std::vector< StringHashData* > &words )
+{
+	// Every key's data, except keys of removed words (they have no word).
+	words.clear();
+	words.reserve( this->database_.getUsedAmount() );
+	for( unsigned key = 0; key < this->database_.getKeysAmount(); ++key )
+		if( getSatelliteData( key )->getWordId() != StringHashData::NO_WORD )
+			words.push_back( getSatelliteData( key ) );
+}
 
-		// Otherwise, insert node in frequency tree and pop it from the stack.
-		else
-		{
-			// Insert in frequency ranking tree.
-			this->frequency_ranking_.insert( traverse.top()->getData() );
-			last = traverse.top();  // Indicate node has been check last.
-			traverse.pop();			// Pop node from the stack.
-		}
+void ReviewAnalyzer::printSupportRanking( unsigned rank_size, unsigned min_frequency, bool greatest )
+{
+	// Index is rebuilt from every word if any score or frequency changed.
+	if( this->support_index_dirty_ )
+	{
+		vector< StringHashData* > words;
+		getWords( words );
+		this->support_index_.build( words );
+		this->support_index_dirty_ = false;
 	}
 
-	// All data was inserted in frequency ranking tree.
+	// Best scores among words seen often enough.
+	vector< StringHashData* > words;
+	if( greatest )
+		this->support_index_.getGreatestScores( rank_size, min_frequency, words );
+	else
+		this->support_index_.getLowestScores( rank_size, min_frequency, words );
+
+	// Amount of digits in rank_size.
+	unsigned digits_amount = 0;
+	for( unsigned size = rank_size; size > 0; size /= 10 )
+		++digits_amount;
+
+	// Print each word with its position.
+	RankingSink sink( cout, SinkFormat::CONSOLE, digits_amount );
+	sink.begin( SortBy::SCORE );
+	for( auto d : words )
+		sink.write( d );
+	sink.end();
+}
+
+bool ReviewAnalyzer::splitMinFrequency( std::string &argument, unsigned &min_frequency )
+{
+	// No "minfreq": argument is left as it is.
+	size_t position = argument.find( "minfreq" );
+	if( position == string::npos )
+		return true;
+
+	// Ranking size must come before "minfreq".
+	if( position == 0 )
+		return false;
+
+	// Minimum frequency follows "minfreq"; ranking size is what comes before it.
+	istringstream frequency( argument.substr( position + 7 ) );
+	string rest;
+	argument.erase( argument.find_last_not_of( " \t", position - 1 ) + 1 );
+	if( !( frequency >> min_frequency ) || frequency >> rest )
+		return false;
+
 	return true;
 }
 
+void ReviewAnalyzer::updateTopKeys( StringHashData *satellite_data )
+{
+	// Score changes move a word in both score heaps; frequency only grows.
+	this->most_positive_.update( satellite_data );
+	this->most_negative_.update( satellite_data );
+	this->most_frequent_.update( satellite_data );
+}
+
+void ReviewAnalyzer::refillTopKeys( TopKeys &top_keys )
+{
+	// One word more than the heap keeps: it's the strongest word left out.
+	unsigned amount = top_keys.getCapacity() + 1;
+	vector< StringHashData* > words;
+
+	// Take strongest words from the ranking answering ranking commands.
+	bool is_array = ( this->ranking_index_ == RankingIndex::SORTED_ARRAY );
+	if( &top_keys == &this->most_positive_ )
+		is_array ? this->frozen_score_ranking_.getGreatestKeys( amount, words ) :
+				this->score_ranking_.getGreatestKeys( amount, words );
+	else if( &top_keys == &this->most_negative_ )
+		is_array ? this->frozen_score_ranking_.getLowestKeys( amount, words ) :
+				this->score_ranking_.getLowestKeys( amount, words );
+	else
+		is_array ? this->frozen_frequency_ranking_.getGreatestKeys( amount, words ) :
+				this->frequency_ranking_.getGreatestKeys( amount, words );
+
+	// Split off the word left out, if there's one.
+	StringHashData *next = nullptr;
+	if( words.size() == amount )
+	{
+		next = words.back();
+		words.pop_back();
+	}
+	top_keys.refill( words, next );
+}
+
 void ReviewAnalyzer::changeToLowercase( std::string &word )
 {
 	// Global locale.
@@ -11,9 +11,27 @@
 
 // Libraries:
 #include <string>
+#include <string_view>
+#include <istream>
+#include <vector>
 #include <utility>
 #include "StringHashTable.h"
+#include "AvlTree.h"
+#include "FrozenRanking.h"
+#include "TopKeys.h"
+#include "ScoreFrequencyIndex.h"
+#include "RankingSink.h"
 #include "Trie.h"
+#include "FrozenStringSet.h"
+
+
+/**
+ * Enumerator to be used as argument to define which structure answers ranking commands.
+ *  AVL_TREE     AvlTree, updated word by word (or built at once, if ranking is deferred).
+ *  SORTED_ARRAY FrozenRanking, built at once from the database when first needed (only
+ *               with deferred ranking; removing a word rebuilds it too).
+ */
+enum RankingIndex { AVL_TREE, SORTED_ARRAY };
 
 
 class ReviewAnalyzer {
@@ -21,8 +39,15 @@ public:
 	/**
 	 * Constructor: initializes ranking trees and hash table (standard size is 150,001).
 	 *  @param hash_size Hash table's initial size.
+	 *  @param index_positions Indicate if positions of words in reviews are recorded, for
+	 *                         phrase queries.
+	 *  @param defer_ranking Indicate if rankings are built at once when first needed, instead
+	 *                       of being updated for every word read.
+	 *  @param ranking_index Structure answering ranking commands (AVL_TREE if rankings
+	 *                       aren't deferred).
 	 */
-	ReviewAnalyzer( unsigned hash_size = 100001 );
+	ReviewAnalyzer( unsigned hash_size = 100001, bool index_positions = true,
+			bool defer_ranking = true, RankingIndex ranking_index = RankingIndex::AVL_TREE );
 
 	/**
 	 * Run analysis program.
@@ -81,12 +106,13 @@ public:
      */
      bool analyzeFile( std::string file_name, bool print = false );
 	/**
-	 * Insert word in database.
+	 * Insert word in database or, if it's already there, count phrase_score as another
+	 * occurrence. Rankings and heaps of strongest words are updated as for words read.
 	 *  @param word Word to be inserted.
 	 *  @param phrase_score Word's score in the phrase.
 	 *  @param index Phrase's index.
-	 *  @param key Word's key in the hash table if found (optional).
-	 *  @return True if inserted, false if it's already in the database.
+	 *  @param key Word's key in the hash table (optional).
+	 *  @return True if inserted, false if it was already in the database.
 	 */
 	bool insert( std::string word, double phrase_score, unsigned index, unsigned *key = nullptr );
 
@@ -99,7 +125,7 @@ public:
 	bool search( std::string word, unsigned *key = nullptr );
 
 	/**
-	 * Remove a word from database.
+	 * Remove a word from database and rankings.
 	 *  @param word Word to be removed.
 	 */
 	void remove( std::string word );
@@ -107,14 +133,18 @@ public:
 	/**
 	 * Command "print+": print a ranking of the most positive words in the database.
 	 *  @param rank_size How many words can be in the ranking list.
+	 *  @param min_frequency Only words seen at least this many times are ranked (optional).
+	 *  @attention Up to 100 words, ranking usually comes from a heap updated
+	 *             word by word, without building (or walking) the full ranking.
 	 */
-	void printMostPositive( unsigned rank_size );
+	void printMostPositive( unsigned rank_size, unsigned min_frequency = 0 );
 
 	/**
 	 * Command "print-": print a ranking of the most negative words in the database.
 	 *  @param rank_size How many words can be in the ranking list.
+	 *  @param min_frequency Only words seen at least this many times are ranked (optional).
 	 */
-	void printMostNegative( unsigned rank_size );
+	void printMostNegative( unsigned rank_size, unsigned min_frequency = 0 );
 
 	/**
 	 * Command "printf": print a ranking of the most frequent words in the database.
@@ -130,6 +160,17 @@ public:
 	 */
 	bool getReviews( std::string word );
 
+	/**
+	 * Command "getr \"phrase\"": create file <phrase's words>"_reviews.csv" containing all
+	 * reviews where a given phrase appears, by intersecting its words' positions. Filtered
+	 * words (stopwords, punctuation) aren't in the database: they're compared with the text
+	 * of reviews where every other word is in place. Without recorded positions, reviews
+	 * containing every word are listed.
+	 *  @param phrase Phrase to search for.
+	 *  @return True if file was created, false otherwise.
+	 */
+	bool getPhraseReviews( std::string phrase );
+
 	/**
 	 * Command "search": search for words starting with given string, printing them.
 	 *  @param word Word or partial word to search for.
@@ -137,6 +178,34 @@ public:
 	 */
 	bool searchWords( std::string word );
 
+	/**
+	 * Command "rank": print a word's position in score and frequency rankings (greatest
+	 * first, words with equal keys sharing a position) and its percentile in each of them.
+	 *  @param word Word to be ranked.
+	 *  @return True if word is in the database and ranked, false otherwise.
+	 */
+	bool printRank( std::string word );
+
+	/**
+	 * Command "range": print words with keys in a range (e.g. score in [a, b], or frequency
+	 * of at least f), straight from the ranking answering ranking commands.
+	 *  @param order Keys compared (SCORE or FREQUENCY).
+	 *  @param low Lowest key in range.
+	 *  @param high Greatest key in range.
+	 *  @param descending Indicate if greatest keys come first.
+	 *  @param format Output format: numbered list, CSV rows or JSON array.
+	 *  @return True if any word is in range, false otherwise.
+	 */
+	bool printRange( SortBy order, double low, double high, bool descending = true,
+			SinkFormat format = SinkFormat::CONSOLE );
+
+	/**
+	 * Command "stats": print lookups' probe histograms, rehashes, load factor and memory
+	 * used by database's and stopwords' hash tables.
+	 *  @param json Indicate if statistics must be printed as a JSON object.
+	 */
+	void printStats( bool json = false );
+
 private:
 	/**
 	 * Get satellite data at position key by reference.
@@ -147,16 +216,55 @@ private:
 	 */
 	StringHashData* getSatelliteData( unsigned key );
 
+	/**
+	 * Get next word of a text (words are separated by whitespace).
+	 *  @param text Text to be split.
+	 *  @param position Where to start looking; updated to just after the word found.
+	 *  @param word Word found, viewing text's characters (no copy is made).
+	 *  @return True if a word was found, false if text has ended.
+	 */
+	bool nextWord( const std::string &text, std::size_t &position, std::string_view &word );
+
 	/**
 	 * Filter characters (e.g. comma) or words (e.g. isn't) for insertion.
-	 *  @param word Word to be filtered. Return two words if they're concatenated.
-	 *  @return True if insertion is allowed (although two words may need insertion)
-	 *          and false otherwise.
+	 *  @param word Word to be filtered.
+	 *  @param hash_value Word's hash value, calculated by database_.hashOf().
+	 *  @return True if insertion is allowed and false otherwise.
 	 */
-	bool filterWord( std::string &word );
+	bool filterWord( std::string_view word, uint64_t hash_value );
 
 	/**
-	 * Read stopwords from a file.
+	 * Find reviews where words appear at given offsets from each other.
+	 *  @param terms Offset of each word in the phrase and reviews where it appears, rarest
+	 *               word first.
+	 *  @param filtered Offset of each filtered word in the phrase and the word, in order.
+	 *  @return Indexes of reviews, in increasing order.
+	 */
+	std::vector< unsigned > matchPhrase(
+			const std::vector< std::pair< unsigned, const PostingList* > > &terms,
+			const std::vector< std::pair< unsigned, std::string_view > > &filtered );
+
+	/**
+	 * Check if a review has given words at given offsets from a token.
+	 *  @param index Review's index.
+	 *  @param start Position of first token of the phrase in the review.
+	 *  @param words Offset of each word from start and the word, in order.
+	 *  @return True if every word is in place, false otherwise.
+	 */
+	bool hasWordsAt( unsigned index, unsigned start,
+			const std::vector< std::pair< unsigned, std::string_view > > &words );
+
+	/**
+	 * Estimate how many distinct words a reviews' file holds from a sample of its first
+	 * lines, extrapolating to the rest of the file by Heaps' law (vocabulary grows as a
+	 * power of text size, with exponent measured between the sample's halves).
+	 *  @param file Reviews' file, read from its start and rewound afterwards.
+	 *  @return Estimated amount of distinct words to be inserted.
+	 */
+	unsigned estimateVocabulary( std::istream &file );
+
+	/**
+	 * Read stopwords from a file, replacing previous ones.
 	 *  @param file_name Name of file with stopwords.
 	 *  @result True if file was read, false otherwise.
 	 */
@@ -165,10 +273,12 @@ private:
 	/**
 	 * Check if a word is a stopword.
 	 *  @param word Word to be evaluated.
+	 *  @param hash_value Word's hash value, calculated by database_.hashOf() (stopwords'
+	 *                    set uses the same hashing function and seed).
 	 *  @return True if it is, false otherwise.
 	 *  @attention False means it isn't in stopwords' database.
 	 */
-	bool isStopword( std::string word );
+	bool isStopword( std::string_view word, uint64_t hash_value );
 
 	/**
 	 * Store review and its score.
@@ -179,7 +289,8 @@ private:
 	unsigned storeReview( std::string review, unsigned score );
 
 	/**
-	 * Update words' score and ranking.
+	 * Update words' score and ranking (with deferred ranking, only its score, marking
+	 * rankings as outdated).
 	 *  @param satellite_data Word to be inserted or updated in ranking tree.
 	 *  @param index Review's index.
 	 *  @param new_score Satellite data's next score.
@@ -188,13 +299,70 @@ private:
 	void updateScore( StringHashData *satellite_data, unsigned index, double new_score = -1.0 );
 
 	/**
-	 * Create words's frequency ranking tree.
+	 * Update words' frequency ranking tree with words read since its last update (eager
+	 * ranking only): each one is removed under the frequency it was ranked with and
+	 * inserted again, so the cost follows the words read, not the database's size.
 	 *  @return True if there're any words to rank, false otherwise.
-	 *  @attention This method has a high cost, it is recommended to use it only
-	 *             after all words have been read.
 	 */
 	bool rankFrequency();
 
+	/**
+	 * Build score and frequency rankings (trees or sorted arrays, whichever answers ranking
+	 * commands) from every word in the database, if they're outdated (only happens with
+	 * deferred ranking).
+	 *  @return True if there're any words to rank, false otherwise.
+	 */
+	bool rankWords();
+
+	/**
+	 * Insert word in database, or count another occurrence of it, using a hash value
+	 * calculated by hashOf() beforehand: the path of every word read or inserted.
+	 *  @param word Word to be inserted.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param phrase_score Word's score in the phrase.
+	 *  @param index Phrase's index.
+	 *  @param key Word's key in the hash table (optional).
+	 *  @return True if inserted, false if it was already in the database.
+	 */
+	bool insert( std::string_view word, uint64_t hash_value, double phrase_score, unsigned index,
+			unsigned *key = nullptr );
+
+	/**
+	 * Get every word in the database.
+	 *  @param words Vector to be filled with words' satellite data (emptied first).
+	 */
+	void getWords( std::vector< StringHashData* > &words );
+
+	/**
+	 * Print a ranking of the most positive (or negative) words among those seen at least
+	 * min_frequency times, from the score and frequency index (rebuilt first if outdated).
+	 *  @param rank_size How many words can be in the ranking list.
+	 *  @param min_frequency Minimum frequency.
+	 *  @param greatest Indicate if most positive words are ranked (most negative otherwise).
+	 */
+	void printSupportRanking( unsigned rank_size, unsigned min_frequency, bool greatest );
+
+	/**
+	 * Split a ranking command's argument "<amount> minfreq <frequency>".
+	 *  @param argument Command's argument; "minfreq" and what follows it are removed.
+	 *  @param min_frequency Minimum frequency, set if argument has one.
+	 *  @return True if argument has no "minfreq" or a valid one, false otherwise.
+	 */
+	bool splitMinFrequency( std::string &argument, unsigned &min_frequency );
+
+	/**
+	 * Update a word in heaps of most positive, most negative and most frequent words.
+	 *  @param satellite_data Word whose score or frequency has changed (or a new word).
+	 */
+	void updateTopKeys( StringHashData *satellite_data );
+
+	/**
+	 * Refill a heap of strongest words from the full ranking answering ranking commands
+	 * (which must be up to date).
+	 *  @param top_keys Heap to be refilled.
+	 */
+	void refillTopKeys( TopKeys &top_keys );
+
 	/**
 	 * Change word (or phrase) to lowercase.
 	 *  @param word Word (or phrase) to be changed.
@@ -209,14 +377,41 @@ private:
 	AvlTree score_ranking_;
 	AvlTree frequency_ranking_;
 
+	// Frequency each word is ranked under in frequency tree, by word's id (0 if it isn't
+	// ranked), and words read since that tree was updated (eager ranking only).
+	std::vector< unsigned > ranked_frequencies_;
+	std::vector< StringHashData* > frequency_changes_;
+
+	// Ranking arrays (used instead of trees if chosen).
+	FrozenRanking frozen_score_ranking_;
+	FrozenRanking frozen_frequency_ranking_;
+	RankingIndex ranking_index_;
+
+	// Scores of words by frequency, for rankings of words seen often enough; outdated by
+	// any change of scores or frequencies.
+	ScoreFrequencyIndex support_index_;
+	bool support_index_dirty_;
+
+	// Heaps of a few strongest words, updated word by word (answer small rankings).
+	TopKeys most_positive_;
+	TopKeys most_negative_;
+	TopKeys most_frequent_;
+
 	// Trie Tree of words.
 	Trie words_;
 
 	// Stopwords to filter.
-	StringHashTable stopwords_;
+	FrozenStringSet stopwords_;
 
 	// Reviews - pair< score, review >.
 	std::vector< std::pair< unsigned, std::string > > reviews_;
+
+	// Indicate if positions of words in reviews are recorded.
+	bool index_positions_;
+
+	// Indicate if rankings are built when first needed, and if they're outdated.
+	bool defer_ranking_;
+	bool rankings_dirty_;
 };
 
 #endif /* REVIEWANALYZER_H_ */
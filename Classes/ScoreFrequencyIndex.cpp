@@ -0,0 +1,194 @@
+/**
+ * Class ScoreFrequencyIndex member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include "ScoreFrequencyIndex.h"
+#include "ParallelSort.h"
+
+using namespace std;
+
+
+ScoreFrequencyIndex::ScoreFrequencyIndex()
+{
+	// No words.
+}
+
+void ScoreFrequencyIndex::build( std::vector< StringHashData* > data )
+{
+	// Frequency of each data, with its data.
+	vector< pair< unsigned, StringHashData* > > sorted;
+	sorted.reserve( data.size() );
+	for( auto d : data )
+		sorted.emplace_back( d->getFrequency(), d );
+
+	// Decreasing frequencies; ties by word's id, so every build has the same order.
+	parallelSort( sorted, []( const pair< unsigned, StringHashData* > &a, const pair< unsigned, StringHashData* > &b )
+	{
+		return a.first > b.first ||
+				( a.first == b.first && a.second->getWordId() < b.second->getWordId() );
+	} );
+
+	// Split sorted pairs in arrays, copying scores (derived from histograms) once.
+	clear();
+	this->data_.reserve( sorted.size() );
+	this->frequencies_.reserve( sorted.size() );
+	this->scores_.reserve( sorted.size() );
+	for( auto &p : sorted )
+	{
+		this->frequencies_.push_back( p.first );
+		this->data_.push_back( p.second );
+		this->scores_.push_back( p.second->getScore() );
+	}
+
+	// Leaves are positions themselves; each inner node keeps its better descendant.
+	unsigned size = getSize();
+	if( size == 0 )
+		return;
+	this->greatest_.assign( 2 * size, NO_POSITION );
+	this->lowest_.assign( 2 * size, NO_POSITION );
+	for( unsigned i = 0; i < size; ++i )
+		this->greatest_[ size + i ] = this->lowest_[ size + i ] = i;
+	for( unsigned node = size - 1; node >= 1; --node )
+	{
+		unsigned left = 2 * node, right = 2 * node + 1;
+		this->greatest_[ node ] = isBetter( this->greatest_[ left ], this->greatest_[ right ], true ) ?
+				this->greatest_[ left ] : this->greatest_[ right ];
+		this->lowest_[ node ] = isBetter( this->lowest_[ left ], this->lowest_[ right ], false ) ?
+				this->lowest_[ left ] : this->lowest_[ right ];
+	}
+}
+
+void ScoreFrequencyIndex::clear()
+{
+	// Release arrays.
+	vector< StringHashData* >().swap( this->data_ );
+	vector< unsigned >().swap( this->frequencies_ );
+	vector< double >().swap( this->scores_ );
+	vector< unsigned >().swap( this->greatest_ );
+	vector< unsigned >().swap( this->lowest_ );
+}
+
+bool ScoreFrequencyIndex::isEmpty() const
+{
+	// Return whether there are no words.
+	return this->data_.empty();
+}
+
+unsigned ScoreFrequencyIndex::getSize() const
+{
+	// Return amount of words.
+	return this->data_.size();
+}
+
+unsigned ScoreFrequencyIndex::countWithSupport( unsigned min_frequency ) const
+{
+	// Words seen often enough come before the first lower frequency.
+	return upper_bound( this->frequencies_.begin(), this->frequencies_.end(), min_frequency,
+			greater< unsigned >() ) - this->frequencies_.begin();
+}
+
+void ScoreFrequencyIndex::getGreatestScores( unsigned amount, unsigned min_frequency,
+		std::vector< StringHashData* > &words ) const
+{
+	// Best scores are the greatest ones.
+	getBestScores( amount, min_frequency, true, words );
+}
+
+void ScoreFrequencyIndex::getLowestScores( unsigned amount, unsigned min_frequency,
+		std::vector< StringHashData* > &words ) const
+{
+	// Best scores are the lowest ones.
+	getBestScores( amount, min_frequency, false, words );
+}
+
+std::size_t ScoreFrequencyIndex::getAllocatedBytes() const
+{
+	// Return bytes allocated for every array.
+	return this->data_.capacity() * sizeof( StringHashData* ) +
+			this->frequencies_.capacity() * sizeof( unsigned ) +
+			this->scores_.capacity() * sizeof( double ) +
+			( this->greatest_.capacity() + this->lowest_.capacity() ) * sizeof( unsigned );
+}
+
+bool ScoreFrequencyIndex::isBetter( unsigned a, unsigned b, bool greatest ) const
+{
+	// No word is never better; any word is better than no word.
+	if( a == NO_POSITION )
+		return false;
+	if( b == NO_POSITION )
+		return true;
+
+	// Scores decide, if they differ; otherwise, words' ids.
+	if( this->scores_[ a ] != this->scores_[ b ] )
+		return greatest ? this->scores_[ a ] > this->scores_[ b ] : this->scores_[ a ] < this->scores_[ b ];
+
+	uint32_t id_a = this->data_[ a ]->getWordId(), id_b = this->data_[ b ]->getWordId();
+	return greatest ? id_a > id_b : id_a < id_b;
+}
+
+unsigned ScoreFrequencyIndex::findBest( unsigned first, unsigned last, bool greatest ) const
+{
+	// Climb from range's leaves, taking nodes that stick out of each end.
+	const vector< unsigned > &tree = greatest ? this->greatest_ : this->lowest_;
+	unsigned best = NO_POSITION;
+	for( first += getSize(), last += getSize(); first < last; first /= 2, last /= 2 )
+	{
+		if( first & 1 )
+		{
+			if( isBetter( tree[ first ], best, greatest ) )
+				best = tree[ first ];
+			++first;
+		}
+		if( last & 1 )
+		{
+			--last;
+			if( isBetter( tree[ last ], best, greatest ) )
+				best = tree[ last ];
+		}
+	}
+
+	return best;
+}
+
+void ScoreFrequencyIndex::getBestScores( unsigned amount, unsigned min_frequency, bool greatest,
+		std::vector< StringHashData* > &words ) const
+{
+	words.clear();
+
+	// Range of positions with best score in it.
+	struct Range {
+		unsigned best;   // Position of range's best score.
+		unsigned first;  // First position.
+		unsigned last;   // Position past the end.
+	};
+
+	// Heap of ranges, best score on top.
+	auto is_worse = [ this, greatest ]( const Range &a, const Range &b ) { return isBetter( b.best, a.best, greatest ); };
+	priority_queue< Range, vector< Range >, decltype( is_worse ) > ranges( is_worse );
+
+	// Words seen often enough are a prefix.
+	unsigned prefix = countWithSupport( min_frequency );
+	if( prefix > 0 )
+		ranges.push( Range{ findBest( 0, prefix, greatest ), 0, prefix } );
+
+	// Take best score of all ranges, then split its range around it.
+	while( words.size() < amount && !ranges.empty() )
+	{
+		Range range = ranges.top();
+		ranges.pop();
+		words.push_back( this->data_[ range.best ] );
+
+		if( range.first < range.best )
+			ranges.push( Range{ findBest( range.first, range.best, greatest ), range.first, range.best } );
+		if( range.best + 1 < range.last )
+			ranges.push( Range{ findBest( range.best + 1, range.last, greatest ), range.best + 1, range.last } );
+	}
+}
@@ -0,0 +1,134 @@
+/**
+ * Definitions of ScoreFrequencyIndex class - ranking of StringHashData by score among
+ * words with a minimum frequency (support), e.g. "most positive words seen at least 50
+ * times", without scanning words that are too rare.
+ *
+ * Words are sorted by decreasing frequency, so the words with frequency of at least f are
+ * always a prefix of that order, found by a binary search. Over that order, two segment
+ * trees (one for greatest, one for lowest scores) keep, for each range of positions, the
+ * position of its best score. A query takes the best score of the prefix, then splits
+ * the prefix around it and keeps the remaining ranges in a heap, each with its best
+ * score: every word found costs one range query, O(log n), so top-K costs O(K log n).
+ *
+ * Like FrozenRanking, it's built at once and only queried afterwards.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef SCOREFREQUENCYINDEX_H_
+#define SCOREFREQUENCYINDEX_H_
+
+// Libraries:
+#include <cstddef>
+#include <vector>
+#include "StringHashData.h"
+
+
+class ScoreFrequencyIndex {
+public:
+	/**
+	 * Constructor: create an empty index.
+	 */
+	ScoreFrequencyIndex();
+
+	/**
+	 * Replace index's contents: data is sorted by frequency with a few threads, then both
+	 * segment trees are filled bottom-up, in O(n log n).
+	 *  @param data Hash table's satellite data to be indexed (in any order).
+	 *  @attention Scores and frequencies are copied: data whose score changes afterwards
+	 *             keeps its place until index is built again.
+	 */
+	void build( std::vector< StringHashData* > data );
+
+	/**
+	 * Remove every word and release memory.
+	 */
+	void clear();
+
+	/**
+	 * Check if index has no words.
+	 *  @return True if empty, false otherwise.
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Get amount of words in index.
+	 *  @return Amount of words.
+	 */
+	unsigned getSize() const;
+
+	/**
+	 * Count words with a minimum frequency, in O(log n).
+	 *  @param min_frequency Minimum frequency.
+	 *  @return Amount of words seen at least min_frequency times.
+	 */
+	unsigned countWithSupport( unsigned min_frequency ) const;
+
+	/**
+	 * Get words with the greatest scores among those with a minimum frequency, in
+	 * decreasing order of scores (ties by greater word's id, as AvlTree's rankings).
+	 *  @param amount Amount of words wanted.
+	 *  @param min_frequency Minimum frequency.
+	 *  @param words Vector to be filled with words' satellite data (emptied first).
+	 */
+	void getGreatestScores( unsigned amount, unsigned min_frequency, std::vector< StringHashData* > &words ) const;
+
+	/**
+	 * Get words with the lowest scores among those with a minimum frequency, in increasing
+	 * order of scores (ties by lower word's id).
+	 *  @param amount Amount of words wanted.
+	 *  @param min_frequency Minimum frequency.
+	 *  @param words Vector to be filled with words' satellite data (emptied first).
+	 */
+	void getLowestScores( unsigned amount, unsigned min_frequency, std::vector< StringHashData* > &words ) const;
+
+	/**
+	 * Get memory allocated for the arrays.
+	 *  @return Bytes allocated outside the object itself.
+	 */
+	std::size_t getAllocatedBytes() const;
+
+private:
+	/**
+	 * Compare words at two positions by score, ties by word's id.
+	 *  @param a Position of a word (or NO_POSITION, which is never better).
+	 *  @param b Position of another word (or NO_POSITION).
+	 *  @param greatest Indicate if greater scores are better (lower ones otherwise).
+	 *  @return True if word at a is better than word at b, false otherwise.
+	 */
+	bool isBetter( unsigned a, unsigned b, bool greatest ) const;
+
+	/**
+	 * Find best score in a range of positions, in O(log n).
+	 *  @param first First position of range.
+	 *  @param last Position past the end of range.
+	 *  @param greatest Indicate if greater scores are better.
+	 *  @return Position of best score (NO_POSITION if range is empty).
+	 */
+	unsigned findBest( unsigned first, unsigned last, bool greatest ) const;
+
+	/**
+	 * Get words with the best scores among those with a minimum frequency.
+	 *  @param amount Amount of words wanted.
+	 *  @param min_frequency Minimum frequency.
+	 *  @param greatest Indicate if greater scores are better.
+	 *  @param words Vector to be filled with words' satellite data, best first (emptied first).
+	 */
+	void getBestScores( unsigned amount, unsigned min_frequency, bool greatest,
+			std::vector< StringHashData* > &words ) const;
+
+	static constexpr unsigned NO_POSITION = 0xFFFFFFFF;  // Position of no word.
+
+
+// Attributes:
+	std::vector< StringHashData* > data_;  // Data, in decreasing order of frequencies.
+	std::vector< unsigned > frequencies_;  // Frequencies, in the same order.
+	std::vector< double > scores_;         // Scores, in the same order.
+	std::vector< unsigned > greatest_;     // Segment tree: position of greatest score of each
+	                                       // range (root at 1, leaves from getSize()).
+	std::vector< unsigned > lowest_;       // Segment tree: position of lowest score of each range.
+};
+
+#endif /* SCOREFREQUENCYINDEX_H_ */
@@ -7,6 +7,7 @@
  */
 
 // Libraries:
+#include <cmath>
 #include "StringHashData.h"
 
 using namespace std;
@@ -14,29 +15,30 @@ using namespace std;
 
 StringHashData::StringHashData()
 {
-	this->score_ = 0.0;   // Initial score.
-	this->frequency_ = 0; // No frequency.
+	this->word_id_ = NO_WORD; // No word.
+	resetLabels();            // No occurrences.
 }
 
-StringHashData::StringHashData( std::string word, double phrase_score )
+StringHashData::StringHashData( std::string_view word, double phrase_score, uint32_t word_id )
 {
 	this->satellite_data_ = word; // Set satellite data (word from text).
+	this->word_id_ = word_id;     // Set word's id.
 
-	this->score_ = phrase_score;  // Set initial score as phrase's score.
-	this->frequency_ = 1;         // Initial frequency.
+	resetLabels();                // Count first occurrence with phrase's label.
+	addLabel( phrase_score );
 }
 
-bool StringHashData::insert( std::string word, double phrase_score, unsigned index )
+bool StringHashData::insert( std::string_view word, double phrase_score, unsigned index,
+		uint32_t word_id )
 {
 	// If position is free, insert word:
 	if( getWord().empty() )
 	{
-		// Assign word as satellite data.
+		// Assign word as satellite data, along with its id.
 		this->satellite_data_ = word;
-		// Set initial frequency as one (1).
-		incrementFrequency();
-		// Set initial score as phrase_score.
-		setScore( phrase_score );
+		this->word_id_ = word_id;
+		// Count first occurrence with phrase_score's label.
+		addLabel( phrase_score );
 		// Add review's index.
 		addIndex( index );
 
@@ -50,26 +52,22 @@ bool StringHashData::insert( std::string word, double phrase_score, unsigned ind
 
 void StringHashData::remove()
 {
-	// Erase stored word.
-	this->satellite_data_.clear();
-
-	// Reset score to zero.
-	setScore( 0.0 );
-	// Reset frequency to zero.
-	resetFrequency();
+	// Forget stored word (its characters belong to whoever stored them).
+	this->satellite_data_ = string_view();
+	this->word_id_ = NO_WORD;
+	// Release indexes of reviews (this data may be reused by another word).
+	this->indexes_.clear();
+
+	// Reset score and frequency to zero.
+	resetLabels();
 }
 
 bool StringHashData::recalculateScore( double phrase_score, unsigned index )
 {
-	// If phrase_score is valid (0.0 ~ 4.0):
-	if( phrase_score >= 0.0 && phrase_score <= 4.0 )
+	// If phrase_score is valid (0.0 ~ 4.0), count it in its label's bin; score is derived
+	// from the histogram whenever it's needed.
+	if( addLabel( phrase_score ) )
 	{
-		// Get sum of all scores so far.
-		unsigned sum_of_scores = static_cast< unsigned >( getScore() * getFrequency() + phrase_score );
-		// Increment frequency by one (1).
-		incrementFrequency();
-		// Calculate and set new score.
-		setScore( sum_of_scores / static_cast< double >( getFrequency() ) );
 		// Add review's index.
 		addIndex( index );
 
@@ -81,28 +79,47 @@ bool StringHashData::recalculateScore( double phrase_score, unsigned index )
 	return false;
 }
 
-std::string StringHashData::getWord()
+void StringHashData::addPosition( unsigned index, unsigned position )
+{
+	// Add position to review's block of positions.
+	this->indexes_.add( index, position );
+}
+
+std::string_view StringHashData::getWord()
 {
 	// Return satellite data (word).
 	return this->satellite_data_;
 }
 
+uint32_t StringHashData::getWordId()
+{
+	// Return word's id.
+	return this->word_id_;
+}
+
 double StringHashData::getScore( bool interpret, std::string *value )
 {
+	// Mean label: sum of labels over amount of occurrences.
+	unsigned frequency = getFrequency();
+	unsigned sum_of_labels = 0;
+	for( unsigned label = 1; label < LABELS; ++label )
+		sum_of_labels += label * this->labels_[ label ];
+	double score = frequency == 0 ? 0.0 : static_cast< double >( sum_of_labels ) / frequency;
+
 	// If the score is to be interpreted, change value string to reflect word's score.
 	if( interpret )
 	{
 		// Negative = 0.00 ~ 0.95
-		if( this->score_ < 0.95 )
+		if( score < 0.95 )
 			*value = "negative";
 		// Slightly negative = 0.95 ~ 1.95
-		else if( this->score_ < 1.95 )
+		else if( score < 1.95 )
 			*value = "slightly negative";
 		// Neutral = 1.95 ~ 2.95
-		else if( this->score_ < 2.95 )
+		else if( score < 2.95 )
 			*value = "neutral";
 		// Slightly positive = 2.95 ~ 3.95
-		else if( this->score_ < 3.95 )
+		else if( score < 3.95 )
 			*value = "slightly positive";
 		// Positive = 3.95 ~ 5.00
 		else
@@ -110,28 +127,71 @@ double StringHashData::getScore( bool interpret, std::string *value )
 	}
 
 	// Return word's score.
-	return this->score_;
+	return score;
 }
 
 unsigned StringHashData::getFrequency()
 {
-	// Return word's frequency.
-	return this->frequency_;
+	// Return word's frequency: occurrences of every label.
+	unsigned frequency = 0;
+	for( auto count : this->labels_ )
+		frequency += count;
+
+	return frequency;
 }
 
-std::vector< unsigned > StringHashData::getIndexes()
+double StringHashData::getVariance()
 {
-	// Return reviews' indexes.
+	// Word with no occurrences.
+	unsigned frequency = getFrequency();
+	if( frequency == 0 )
+		return 0.0;
+
+	// Mean of squared distances to mean label.
+	double score = getScore();
+	double sum_of_squares = 0.0;
+	for( unsigned label = 0; label < LABELS; ++label )
+		sum_of_squares += this->labels_[ label ] * ( label - score ) * ( label - score );
+
+	return sum_of_squares / frequency;
+}
+
+double StringHashData::getMedian()
+{
+	// Word with no occurrences.
+	unsigned frequency = getFrequency();
+	if( frequency == 0 )
+		return 0.0;
+
+	// Mean of both middle occurrences' labels (the same one if frequency is odd).
+	return ( labelAt( ( frequency - 1 ) / 2 ) + labelAt( frequency / 2 ) ) / 2.0;
+}
+
+unsigned StringHashData::getLabelCount( unsigned label )
+{
+	// Return label's count, zero if label is invalid.
+	return label < LABELS ? this->labels_[ label ] : 0;
+}
+
+const PostingList& StringHashData::getIndexes()
+{
+	// Return reviews' indexes by reference.
 	return this->indexes_;
 }
 
-bool StringHashData::setScore( double score )
+std::size_t StringHashData::getAllocatedBytes()
 {
-	// Assign score to this word's score if valid:
+	// Bytes allocated for indexes (word's characters aren't owned by this data).
+	return this->indexes_.getAllocatedBytes();
+}
+
+bool StringHashData::addLabel( double score )
+{
+	// Count score in its label's bin if valid:
 	if( score >= 0.0 && score <= 4.0 )
 	{
-		// Set word's score.
-		this->score_ = score;
+		// Increment nearest label's count.
+		this->labels_[ lround( score ) ]++;
 		// Indicate that score is valid.
 		return true;
 	}
@@ -140,36 +200,29 @@ bool StringHashData::setScore( double score )
 	return false;
 }
 
-bool StringHashData::addIndex( unsigned index )
+unsigned StringHashData::labelAt( unsigned rank )
 {
-	// Search for index in the vector.
-	bool is_inserted = false;
-	// Vector's index.
-	unsigned i = 0;
-	while( i < this->indexes_.size() && this->indexes_.at( i ) != index )
-	{
-		++i;
-	}
-
-	// If index is valid, insert it.
-	if( i == this->indexes_.size() )
+	// Skip labels whose occurrences are all ranked before rank.
+	unsigned label = 0;
+	while( label < LABELS - 1 && rank >= this->labels_[ label ] )
 	{
-		this->indexes_.push_back( index );
-		is_inserted = true;
+		rank -= this->labels_[ label ];
+		++label;
 	}
 
-	// If index is inserted, return true. Otherwise, return false.
-	return is_inserted;
+	// Return label that holds occurrence at rank.
+	return label;
 }
 
-void StringHashData::incrementFrequency()
+bool StringHashData::addIndex( unsigned index )
 {
-	// Increment frequency by one (1).
-	this->frequency_++;
+	// Include index unless it's already there (only the last index is compared when
+	// indexes arrive in increasing order).
+	return this->indexes_.add( index );
 }
 
-void StringHashData::resetFrequency()
+void StringHashData::resetLabels()
 {
-	// Set frequency to zero (0).
-	this->frequency_ = 0;
+	// Set every label's count to zero (0).
+	this->labels_.fill( 0 );
 }
@@ -1,6 +1,10 @@
 /**
  *  Definitions of StringHashData class - satellite data for StringHashTable class.
  *
+ * A word's scores are kept as a histogram: how many times it was written in a review of
+ * each label (0 ~ 4). Score, frequency, variance and median are derived from it exactly,
+ * and each occurrence costs a single increment.
+ *
  *  Created on: July 7th, 2017
  *     Authors: Aline Weber
  *              Renan Kummer
@@ -11,11 +15,17 @@
 
 // Libraries:
 #include <string>
-#include <vector>
+#include <string_view>
+#include <array>
+#include <cstdint>
+#include "PostingList.h"
 
 
 class StringHashData {
 public:
+	static constexpr uint32_t NO_WORD = 0xFFFFFFFF;  // Id of data with no word.
+	static constexpr unsigned LABELS = 5;            // Review labels, 0 ~ 4.
+
 	/**
 	 *  Constructor: sets hash table position as free.
 	 */
@@ -26,39 +36,60 @@ public:
 	 * initialize it with its score in the phrase.
 	 *  @param word String to be inserted.
 	 *  @param phrase_score Overall score of phrase where this word was written.
+	 *  @param word_id Word's id (optional).
+	 *  @attention Word's characters aren't copied: they must outlive this data.
 	 */
-	StringHashData( std::string word, double phrase_score );
+	StringHashData( std::string_view word, double phrase_score, uint32_t word_id = NO_WORD );
 
 	/**
 	 * Set key and word data.
 	 *  @param word String to be inserted.
 	 *  @param phrase_score Overall score of phrase where this word was written.
 	 *  @param index Index to review where this word was written.
+	 *  @param word_id Word's id (optional).
 	 *  @return True if inserted, false it was already inserted..
+	 *  @attention Word's characters aren't copied: they must outlive this data
+	 *             (StringHashTable keeps them in its WordArena).
 	 */
-	bool insert( std::string word, double phrase_score, unsigned index );
+	bool insert( std::string_view word, double phrase_score, unsigned index,
+			uint32_t word_id = NO_WORD );
 
 	/**
-	 * Remove satellite data and reset score and frequency.
+	 * Remove satellite data and indexes of reviews, and reset score and frequency.
 	 */
 	void remove();
 
 	/**
-	 * Recalculate score of expressed feelings with phrase_score.
-	 *  @param phrase_score Overall score of phrase where this word was written.
+	 * Count another occurrence of this word, with phrase_score's label.
+	 *  @param phrase_score Overall score of phrase where this word was written (rounded
+	 *                      to the nearest label).
 	 *  @param index Index to review where this word was written.
 	 *  @return True if phrase_score is valid, false otherwise.
 	 */
 	bool recalculateScore( double phrase_score, unsigned index );
 
+	/**
+	 * Record a position of this word's token in a review (review's index is included too,
+	 * if it's missing).
+	 *  @param index Index to review where this word was written.
+	 *  @param position Position of the token among the review's tokens (from 0).
+	 */
+	void addPosition( unsigned index, unsigned position );
+
 	/**
 	 * Get satellite data (word from text).
-	 *  @return Satellite data (word from text).
+	 *  @return Satellite data (word from text), viewed without copies.
 	 */
-	std::string getWord();
+	std::string_view getWord();
 
 	/**
-	 * Get this word's score of expressed feelings.
+	 * Get word's id (its key in the hash table that stores it).
+	 *  @return Word's id, NO_WORD if it has none.
+	 */
+	uint32_t getWordId();
+
+	/**
+	 * Get this word's score of expressed feelings (mean label of its occurrences).
 	 *  @param interpret Indicate if score should be interpreted to negative/positive/neutral,
 	 *                   in which case a string must be passed by reference as argument.
 	 *  @param value String with negative, positive or neutral evaluation, required if client
@@ -73,44 +104,75 @@ public:
 	 */
 	unsigned getFrequency();
 
+	/**
+	 * Get variance of labels of this word's occurrences.
+	 *  @return Variance (zero if word has no occurrences).
+	 */
+	double getVariance();
+
+	/**
+	 * Get median label of this word's occurrences.
+	 *  @return Median (mean of both middle labels if frequency is even; zero if word has
+	 *          no occurrences).
+	 */
+	double getMedian();
+
+	/**
+	 * Get amount of occurrences of this word with a given label.
+	 *  @param label Review's label (0 ~ 4).
+	 *  @return Amount of occurrences (zero for invalid labels).
+	 */
+	unsigned getLabelCount( unsigned label );
+
 	/**
 	 * Get indexes of reviews where this word appeared.
-	 *  @return Vector of indexes.
+	 *  @return Compressed list of indexes, in increasing order (iterated without copies),
+	 *          with positions of the word in each review if they were recorded.
+	 */
+	const PostingList& getIndexes();
+
+	/**
+	 * Get memory this data allocated for its indexes.
+	 *  @return Bytes allocated outside the object itself.
 	 */
-	std::vector< unsigned > getIndexes();
+	std::size_t getAllocatedBytes();
 
 private:
 	/**
-	 * Set this word's score of expressed feelings.
-	 *  @param score Word's score.
+	 * Count an occurrence with a given score's label.
+	 *  @param score Phrase's score (0.0 ~ 4.0, rounded to the nearest label).
 	 *  @return True if score is valid, false otherwise.
 	 */
-	bool setScore( double score );
+	bool addLabel( double score );
 
 	/**
-	 * Include a given review's index at indexes_ vector.
-	 *  @param index Review's index.
-	 *  @return True if included, false if it was already included.
+	 * Find the label of the occurrence at a given rank, labels sorted in increasing order.
+	 *  @param rank Occurrence's rank (0 ~ frequency - 1).
+	 *  @return Label.
 	 */
-	bool addIndex( unsigned index );
+	unsigned labelAt( unsigned rank );
 
 	/**
-	 * Increment word's frequency.
+	 * Include a given review's index at indexes_ list.
+	 *  @param index Review's index.
+	 *  @return True if included, false if it was already included.
+	 *  @attention Constant time when indexes arrive in increasing order, as they do while
+	 *             reading a file.
 	 */
-	void incrementFrequency();
+	bool addIndex( unsigned index );
 
 	/**
-	 * Reset frequency to zero.
+	 * Reset every label's count to zero.
 	 */
-	void resetFrequency();
+	void resetLabels();
 
 
 // Attributes:
-	std::string satellite_data_;      // Word from review.
-	std::vector< unsigned > indexes_; // Indexes of reviews where word was written.
+	std::string_view satellite_data_; // Word from review (characters kept by a WordArena).
+	PostingList indexes_;             // Indexes of reviews where word was written.
 
-	double score_;        // Score for expressed feelings.
-	unsigned frequency_;  // Amount of times word was found in reviews.
+	std::array< uint32_t, LABELS > labels_;  // Occurrences of word per review label.
+	uint32_t word_id_;                       // Word's id.
 };
 
 #endif /* STRINGHASHDATA_H_ */
@@ -8,150 +8,413 @@
 
 // Libraries:
 #include <string>
-#include <stack>
 #include <cmath>
+#include <algorithm>
 #include "StringHashTable.h"
 
+// SSE2 compares a whole group of control bytes at once; other targets use a loop.
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 using namespace std;
 
 
-StringHashTable::StringHashTable( unsigned size )
-	: table_( size )  // Create hash table with given size.
+StringHashTable::StringHashTable( unsigned size, HashPolicy policy, uint64_t seed,
+		CapacityPolicy capacity, double max_load, ProbingMode probing )
+	: hasher_( policy, seed ),          // Select hashing function.
+	  capacity_( capacity, max_load )   // Select sizing policy.
 {
+	// Create hash table with given size, rounded up to an amount of groups allowed.
+	allocate( this->table_, this->capacity_.roundUp( ( size + GROUP_SIZE - 1 ) / GROUP_SIZE ) );
+
 	// No data is inserted.
 	this->amount_of_data_ = 0;
 
 	// No collisions occurred.
 	this->collisions_ = 0;
 
+	// No words were removed.
+	this->tombstones_ = 0;
+
+	// Rehash incrementally; no rehash occurred so far.
+	this->rehash_mode_ = RehashMode::INCREMENTAL;
+	this->migrated_groups_ = 0;
+
+	// Select how positions are probed.
+	this->probing_mode_ = probing;
+
 	// Calculate maximum rate of occupation.
 	calculateMaxRate();
 }
 
-bool StringHashTable::insert( std::string word, double phrase_score, unsigned index, unsigned *key )
+bool StringHashTable::insert( std::string_view word, double phrase_score, unsigned index, unsigned *key )
+{
+	// Indicate word was inserted.
+	bool is_inserted;
+
+	// Find or insert word, hashing it only once.
+	unsigned word_key = findOrInsert( word, hashOf( word ), phrase_score, index, &is_inserted );
+
+	// If requested, return key to this word as well.
+	if( key != nullptr )
+		*key = word_key;
+
+	return is_inserted;
+}
+
+unsigned StringHashTable::findOrInsert( std::string_view word, uint64_t hash_value, double phrase_score,
+		unsigned index, bool *is_inserted )
 {
-	// Hash value for given satellite data.
-	unsigned hash_num;
+	// If rehashing, move some groups of old table.
+	if( isRehashing() )
+	{
+		auto start = chrono::steady_clock::now();
+		migrate( MIGRATION_GROUPS );
+		recordPause( start );
+	}
+
+	// Key to word.
+	unsigned key;
+	// Groups checked.
+	unsigned probes;
+
+	// If word is already in the hash table, return its key.
+	bool is_found = find( word, hash_value, &key, &probes );
+	this->stats_.recordLookup( is_found, probes );
 
-	// If word isn't in the hash table:
-	if( !search( word, &hash_num ) )
+	if( is_found )
 	{
-		// Calculate h( hash_num ).
-		hash_num = hash( word );
+		if( is_inserted != nullptr )
+			*is_inserted = false;
 
-		// If hash table at hash_num is free, insert data.
-		if( isFree( hash_num ) )
-		{
-			// Create object to put data.
-			setData( new StringHashData, hash_num );
+		return key;
+	}
 
-			// Put word and score in satellite data.
-			getData( hash_num )->insert( word, phrase_score, index );
+	// Reuse satellite data of a removed word, or create it at the end of the side array.
+	if( !this->free_keys_.empty() )
+	{
+		key = this->free_keys_.back();
+		this->free_keys_.pop_back();
+	}
+	else
+	{
+		key = this->entries_.size();
+		this->entries_.emplace_back();
+	}
 
-			// If requested, return key to this word as well.
-			if( key != nullptr )
-				*key = hash_num;
-		}
+	// Copy word's characters to the arena, then put them, score and id (word's key) in
+	// satellite data.
+	getData( key )->insert( this->words_.store( word ), phrase_score, index, key );
+
+	// Word's metadata.
+	Slot slot{ hash_value, static_cast< uint32_t >( word.size() ), key };
+
+	// Robin Hood tables place it by linear probing, displacing words closer to their home.
+	if( getProbingMode() == ProbingMode::ROBIN_HOOD )
+		placeRobinHood( this->table_, slot );
+	else
+	{
+		// Obtain a free position in the first group (following Double Hashing) that has one.
+		unsigned position = solveCollision( this->table_, word, hash_value );
+
+		// A removed word's position is reused.
+		if( this->table_.control[ position ] == DELETED )
+			this->tombstones_--;
+
+		// Place word's metadata in the table.
+		setSlot( this->table_, position, slot );
+	}
+
+	// Increment amount of data stored.
+	this->amount_of_data_++;
+
+	// If hash table's occupied space (removed words' positions included) is greater than
+	// or equal to maximum rate, rebuild it and reinsert data in appropriate positions:
+	// at the same size if tombstones are most of the occupied space, at twice the size
+	// otherwise.
+	if( getUsedAmount() + getTombstonesAmount() >= getMaxRate() * getSize() )
+	{
+		auto start = chrono::steady_clock::now();
 
-		// Otherwise, a collision occurred, search for empty position.
+		if( getUsedAmount() < getMaxRate() * getSize() / 2 )
+			rehash( getGroupsAmount( this->table_ ) );
 		else
-		{
-			// Obtain an empty position using Double Hashing.
-			hash_num = solveCollision( word );
+			rehash( this->capacity_.grow( getGroupsAmount( this->table_ ) ) );
 
-			// Create object to put data.
-			setData( new StringHashData, hash_num );
+		recordPause( start );
+	}
 
-			// Place word and score in satellite data.
-			getData( hash_num )->insert( word, phrase_score, index );
+	// Indicate new data has been inserted.
+	if( is_inserted != nullptr )
+		*is_inserted = true;
 
-			// If requested, return key to this word as well.
-			if( key != nullptr )
-				*key = hash_num;
-		}
+	return key;
+}
+
+bool StringHashTable::search( std::string_view word, unsigned *key )
+{
+	// Search using word's hash value.
+	return search( word, hashOf( word ), key );
+}
 
-		// Increment amount of data stored.
-		this->amount_of_data_++;
+bool StringHashTable::search( std::string_view word, uint64_t hash_value, unsigned *key )
+{
+	// If rehashing, move some groups of old table.
+	if( isRehashing() )
+	{
+		auto start = chrono::steady_clock::now();
+		migrate( MIGRATION_GROUPS );
+		recordPause( start );
+	}
+
+	// Search using given hash value, counting groups checked.
+	unsigned probes;
+	bool is_found = find( word, hash_value, key, &probes );
+	this->stats_.recordLookup( is_found, probes );
+
+	return is_found;
+}
+
+uint64_t StringHashTable::hashOf( std::string_view word )
+{
+	// Calculate hash value with this table's hashing function.
+	return this->hasher_.hash( word );
+}
+
+bool StringHashTable::find( std::string_view word, uint64_t hash_value, unsigned *key,
+		unsigned *probes )
+{
+	// Groups checked in each table.
+	unsigned current_probes = 0, old_probes = 0;
 
-		// If hash table's occupied space is greater than or equal to maximum rate,
-		// expand it and reinsert data in appropriate positions.
-		if( getUsedRate() >= getMaxRate() )
-			rehash();
+	// Search current table, then old table if it's still being moved.
+	unsigned position = locate( this->table_, word, hash_value, &current_probes );
+	const Table *table = &this->table_;
 
-		// Indicate new data has been inserted.
-		return true;
+	if( position == NOT_FOUND && isRehashing() )
+	{
+		position = locate( this->old_table_, word, hash_value, &old_probes );
+		table = &this->old_table_;
 	}
 
 	// If requested, return key to this word as well.
-	if( key != nullptr )
-		*key = hash_num;
+	if( position != NOT_FOUND && key != nullptr )
+		*key = table->slots[ position ].entry;
 
-	// Indicate data was already inserted.
-	return false;
+	// If requested, return amount of groups checked as well.
+	if( probes != nullptr )
+		*probes = current_probes + old_probes;
+
+	return position != NOT_FOUND;
 }
 
-bool StringHashTable::search( std::string word, unsigned *key )
+unsigned StringHashTable::locate( const Table &table, std::string_view word, uint64_t hash_value,
+		unsigned *probes )
 {
-	// Hash value for word = h( word ).
-	unsigned hash_num;
+	// Robin Hood tables are probed position by position.
+	if( getProbingMode() == ProbingMode::ROBIN_HOOD )
+		return locateRobinHood( table, word, hash_value, probes );
+
+	// Word's position, if found.
+	unsigned position = NOT_FOUND;
+
+	// Group for word = h( word ).
+	unsigned group = hash( table, hash_value );
 	// Double hash's round.
 	unsigned round = 1;
-
-	// Calculate h( word ).
-	hash_num = hash( word );
+	// Word's 7-bit tag.
+	uint8_t word_tag = tag( hash_value );
 
 	// Indicate that word has been found.
 	bool is_found = false;
+	// Indicate that a group with never occupied positions has been reached.
+	bool is_end = false;
 
-	// Search for word until either it's found or a position that wasn't
-	// previously occupied is found.
-	while( !is_found && getData( hash_num ) != nullptr )
+	// Search for word group by group until either it's found or a group with a position
+	// that wasn't previously occupied is found.
+	while( !is_found && !is_end )
 	{
-		// If word has been found, indicate so.
-		if( getData( hash_num )->getWord() == word )
+		// Positions in group whose tag matches word's tag (one bit per position).
+		unsigned matches = matchTag( table, group, word_tag );
+
+		// Check metadata of matching positions; satellite data is only read when hash
+		// value and length match as well.
+		while( matches != 0 && !is_found )
 		{
-			is_found = true;
+			// Lowest matching position.
+			unsigned match = group * GROUP_SIZE + __builtin_ctz( matches );
+			const Slot &slot = table.slots[ match ];
+
+			if( slot.hash == hash_value && slot.length == word.size() &&
+					getData( slot.entry )->getWord() == word )
+			{
+				is_found = true;
+				position = match;
+			}
+
+			// Clear lowest bit.
+			matches &= matches - 1;
+		}
+
+		// If group has a never occupied position, word can't be in any further group
+		// (removed words' positions don't stop the search).
+		if( !is_found && matchTag( table, group, EMPTY ) != 0 )
+			is_end = true;
 
-			// If requested, return key to this word as well.
-			if( key != nullptr )
-				*key = hash_num;
+		// Otherwise, recalculate group using Double Hashing.
+		else if( !is_found )
+		{
+			group = doubleHash( table, word, hash_value, round );
+			++round;
 		}
+	}
+
+	// If requested, return amount of groups checked as well.
+	if( probes != nullptr )
+		*probes = round;
 
-		// Otherwise, recalculate hash using Double Hashing.
+	// Return word's position.
+	return position;
+}
+
+unsigned StringHashTable::locateRobinHood( const Table &table, std::string_view word,
+		uint64_t hash_value, unsigned *probes )
+{
+	// Word's position, if found.
+	unsigned found = NOT_FOUND;
+
+	// Start at word's home position.
+	unsigned position = home( table, hash_value );
+	// Distance from word's home position.
+	unsigned distance_from_home = 0;
+	// Word's 7-bit tag.
+	uint8_t word_tag = tag( hash_value );
+
+	// Check positions one after another until the word is found, a free position is reached
+	// or a word closer to its home is reached (the one searched for would have taken its
+	// place, so it can't be any further).
+	while( found == NOT_FOUND && table.control[ position ] != EMPTY &&
+			distance( table, position ) >= distance_from_home )
+	{
+		// Satellite data is only read when tag, hash value and length match.
+		const Slot &slot = table.slots[ position ];
+
+		if( table.control[ position ] == word_tag && slot.hash == hash_value &&
+				slot.length == word.size() && getData( slot.entry )->getWord() == word )
+			found = position;
 		else
 		{
-			hash_num = doubleHash( word, round );
-			++round;
+			position = next( table, position );
+			++distance_from_home;
 		}
 	}
 
-	// Return if the word was found.
-	return is_found;
+	// If requested, return amount of positions checked as well.
+	if( probes != nullptr )
+		*probes = distance_from_home + 1;
+
+	// Return word's position.
+	return found;
 }
 
-void StringHashTable::remove( std::string word )
+void StringHashTable::remove( std::string_view word )
 {
-	// Hash value for word.
-	unsigned hash_num;
+	// If rehashing, move some groups of old table.
+	if( isRehashing() )
+	{
+		auto start = chrono::steady_clock::now();
+		migrate( MIGRATION_GROUPS );
+		recordPause( start );
+	}
 
-	// If word is in the tree, remove it.
-	if( search( word, &hash_num ) )
+	// Word's hash value.
+	uint64_t hash_value = hashOf( word );
+
+	// Search current table, then old table if it's still being moved.
+	Table *table = &this->table_;
+	unsigned position = locate( *table, word, hash_value );
+
+	if( position == NOT_FOUND && isRehashing() )
 	{
-		getData( hash_num )->remove();
+		table = &this->old_table_;
+		position = locate( *table, word, hash_value );
+	}
+
+	// If word is in the table, remove it.
+	if( position != NOT_FOUND )
+	{
+		// Release satellite data and keep its key for reuse.
+		unsigned key = table->slots[ position ].entry;
+		getData( key )->remove();
+		this->free_keys_.push_back( key );
+
+		// Robin Hood tables shift following words back instead. An old table being moved
+		// can't, or words not moved yet could slip into groups already moved.
+		if( getProbingMode() == ProbingMode::ROBIN_HOOD && table == &this->table_ )
+			shiftBackward( *table, position );
+		else
+		{
+			// Leave a tombstone, so searches keep probing past this position (its hash value is
+			// kept, so Robin Hood distances still hold). Old table's tombstones are dropped with
+			// it, so only current table's ones are counted.
+			table->slots[ position ].entry = FREE_ENTRY;
+			table->control[ position ] = DELETED;
+			if( table == &this->table_ )
+				this->tombstones_++;
+		}
+
 		this->amount_of_data_--;
 	}
 }
 
+void StringHashTable::compact()
+{
+	// Rebuild table at the same size, leaving every tombstone behind.
+	auto start = chrono::steady_clock::now();
+	rehash( getGroupsAmount( this->table_ ) );
+	migrate( getGroupsAmount( this->old_table_ ) );
+	recordPause( start );
+}
+
+void StringHashTable::reserve( unsigned amount )
+{
+	// Smallest amount of groups allowed whose maximum occupation is greater than amount
+	// (a table is rehashed when its occupation reaches the maximum).
+	unsigned groups = this->capacity_.roundUp(
+			ceil( amount / this->capacity_.getMaxLoad() / GROUP_SIZE ) );
+	while( floor( groups * GROUP_SIZE * this->capacity_.getMaxLoad() ) <= amount )
+	{
+		// Stop at the largest amount of groups allowed.
+		unsigned next_groups = this->capacity_.roundUp( groups + 1 );
+		if( next_groups <= groups )
+			break;
+
+		groups = next_groups;
+	}
+
+	// Current table is big enough.
+	if( groups <= getGroupsAmount( this->table_ ) )
+		return;
+
+	// Move every word to a table of that size right away, so a bulk load starts without
+	// an old table to search.
+	auto start = chrono::steady_clock::now();
+	rehash( groups );
+	migrate( getGroupsAmount( this->old_table_ ) );
+	recordPause( start );
+}
+
 StringHashData* StringHashTable::getData( unsigned key )
 {
-	// Return pointer to satellite data at position key.
-	return this->table_.at( key );
+	// Return pointer to satellite data with given key.
+	return &this->entries_.at( key );
 }
 
 unsigned StringHashTable::getSize()
 {
 	// Return hash table's current size.
-	return this->table_.size();
+	return this->table_.slots.size();
 }
 
 unsigned StringHashTable::getUsedAmount()
@@ -160,12 +423,41 @@ unsigned StringHashTable::getUsedAmount()
 	return this->amount_of_data_;
 }
 
+unsigned StringHashTable::getKeysAmount()
+{
+	// Return size of the array of satellite data.
+	return this->entries_.size();
+}
+
+bool StringHashTable::setMaxLoadFactor( double max_load )
+{
+	// Validate and set maximum load factor.
+	if( !this->capacity_.setMaxLoad( max_load ) )
+		return false;
+
+	// Recalculate maximum rate of occupation (a fuller table grows on next insertion).
+	calculateMaxRate();
+	return true;
+}
+
+CapacityPolicy StringHashTable::getCapacityPolicy()
+{
+	// Return sizing policy in use.
+	return this->capacity_.getPolicy();
+}
+
 double StringHashTable::getMaxRate()
 {
 	// Return maximum rate of occupation.
 	return this->max_rate_;
 }
 
+unsigned StringHashTable::getTombstonesAmount()
+{
+	// Return amount of positions left by removed words.
+	return this->tombstones_;
+}
+
 double StringHashTable::getUsedRate()
 {
 	// Return rate of hash table's used space.
@@ -178,66 +470,125 @@ unsigned StringHashTable::getCollisionsNum()
 	return this->collisions_;
 }
 
-void StringHashTable::setData( StringHashData *data, unsigned key )
+HashPolicy StringHashTable::getHashPolicy()
 {
-	// Assign data to hash table's position.
-	this->table_.at( key ) = data;
+	// Return hashing function in use.
+	return this->hasher_.getPolicy();
 }
 
-void StringHashTable::clear( unsigned key )
+const StringHasher& StringHashTable::getHasher()
 {
-	// Clear hash table's position.
-	delete this->table_.at( key );
+	// Return hashing function in use.
+	return this->hasher_;
+}
 
-	this->table_.at( key ) = nullptr;
+unsigned StringHashTable::getProbeLength( std::string_view word )
+{
+	// Amount of groups checked.
+	unsigned probes = 0;
+
+	// Search for word, counting groups.
+	find( word, hashOf( word ), nullptr, &probes );
+
+	return probes;
 }
 
-unsigned StringHashTable::hash( std::string word )
+void StringHashTable::setRehashMode( RehashMode mode )
 {
-	unsigned hash_num = 0;     // Hash result for word = h( word ).
-	const unsigned prime = 7;  // Prime number for polynomial hashing function.
-	unsigned power = 1;        // Power to raise prime to.
+	// Set rehashing mode.
+	this->rehash_mode_ = mode;
 
-	// Iterator to get each character from word.
-	string::iterator letter = word.begin();
-	// Calculate hash for word using each character.
-	while( letter != word.end() )
-	{
-		long long unsigned prime_raised = prime;
+	// Full rehashing never leaves an old table behind.
+	if( mode == RehashMode::FULL && isRehashing() )
+		migrate( getGroupsAmount( this->old_table_ ) );
+}
 
-		// Calculate prime raised to power % getSize().
-		for( unsigned p = 1; p < power; ++p )
-		{
-			prime_raised *= prime_raised;
-			prime_raised %= 1000000007;
-		}
+ProbingMode StringHashTable::getProbingMode()
+{
+	// Return probing mode.
+	return this->probing_mode_;
+}
 
-		// h( word ) = c * p^i  |  c is a character from word; p is a prime number; i is a counter starting at 0.
-		hash_num += *letter * prime_raised;
+RehashMode StringHashTable::getRehashMode()
+{
+	// Return rehashing mode.
+	return this->rehash_mode_;
+}
 
-		// If h( word ) is currently greater than hash's size, calculate modulus by size.
-		if( hash_num > getSize() )
-			hash_num %= getSize();
+bool StringHashTable::isRehashing()
+{
+	// An old table exists only while it's being moved.
+	return !this->old_table_.control.empty();
+}
 
-		// Increment iterator.
-		++letter;
-		// Increment power.
-		++power;
-	}
+unsigned StringHashTable::getRehashesNum()
+{
+	// Return number of rehashes.
+	return this->stats_.getRehashesNum();
+}
 
-	// Return h( word ).
-	return hash_num;
+double StringHashTable::getMaxPause()
+{
+	// Return longest pause (microseconds).
+	return this->stats_.getMaxPause();
+}
+
+HashTableStats StringHashTable::getStats()
+{
+	// Memory used by positions of both tables.
+	size_t bytes = sizeof( *this );
+	for( const Table *table : { &this->table_, &this->old_table_ } )
+		bytes += table->control.capacity() + table->slots.capacity() * sizeof( Slot );
+
+	// Memory used by satellite data and words' characters.
+	bytes += this->entries_.size() * sizeof( StringHashData ) +
+			this->free_keys_.capacity() * sizeof( unsigned ) + this->words_.getAllocatedBytes();
+	for( auto &data : this->entries_ )
+		bytes += data.getAllocatedBytes();
+
+	// Counters along with current occupation.
+	HashTableStats stats = this->stats_;
+	stats.setOccupation( getUsedAmount(), getSize(), getTombstonesAmount(), bytes );
+
+	return stats;
+}
+
+void StringHashTable::setSlot( Table &table, unsigned position, const Slot &slot )
+{
+	// Assign word's metadata and tag to table's position.
+	table.slots[ position ] = slot;
+	table.control[ position ] = tag( slot.hash );
+}
+
+void StringHashTable::allocate( Table &table, unsigned groups )
+{
+	// All positions are free.
+	table.control.assign( groups * GROUP_SIZE, EMPTY );
+	table.slots.assign( groups * GROUP_SIZE, Slot{ 0, 0, FREE_ENTRY } );
+}
+
+unsigned StringHashTable::hash( const Table &table, uint64_t hash_value )
+{
+	// Return h( word ) reduced to amount of groups.
+	return this->capacity_.reduce( hash_value, getGroupsAmount( table ) );
 }
 
-unsigned StringHashTable::doubleHash( std::string word, unsigned round )
+unsigned StringHashTable::doubleHash( const Table &table, std::string_view word,
+		uint64_t hash_value, unsigned round )
 {
-	long long unsigned hash_num = hash( word); // Hash result for word = h( word ).
+	// Seeded policy: h( word, i ) = h1( word ) + i * h2( word ), both taken from the
+	// same 64-bit hash value.
+	if( getHashPolicy() == HashPolicy::SEEDED )
+		return this->capacity_.wrap( hash( table, hash_value ) + static_cast< uint64_t >( round ) *
+				this->capacity_.step( hash_value, getGroupsAmount( table ) ), getGroupsAmount( table ) );
+
+	long long unsigned hash_num = hash( table, hash_value ); // Hash result for word = h( word ).
 	// Prime number for polynomial hashing function.
-	const unsigned prime = findNextPrime( 13 * round );
+	const unsigned prime = TableCapacity::nextPrime( 13 * round );
 	unsigned power = 1;        // Power to raise prime to.
 
 	// Iterator to get each character from word.
-	string::iterator letter = word.begin();
+	string_view::const_iterator letter = word.begin();
 	// Calculate hash for word using each character.
 	while( letter != word.end() )
 	{
@@ -265,136 +616,226 @@ unsigned StringHashTable::doubleHash( std::string word, unsigned round )
 	}
 
 	// Return h( word ).
-	return hash_num % getSize();
+	return this->capacity_.wrap( hash_num, getGroupsAmount( table ) );
 }
 
-unsigned StringHashTable::solveCollision( std::string word )
+unsigned StringHashTable::solveCollision( Table &table, std::string_view word, uint64_t hash_value )
 {
-	unsigned hash_num = 0;   // Hash result for word = h( word ).
-	unsigned round = 1;      // Double hashing number of calls so far.
+	unsigned group = hash( table, hash_value );  // Group for word = h( word ).
+	unsigned round = 1;                          // Double hashing number of calls so far.
 
-	// Recalculate hashing function for word until a free space is found.
-	do
+	// Free positions in group (one bit per position), including removed words' ones.
+	unsigned free_positions = matchTag( table, group, EMPTY ) | matchTag( table, group, DELETED );
+
+	// Recalculate hashing function for word until a group with free space is found.
+	while( free_positions == 0 )
 	{
 		// Increment number of collisions.
 		this->collisions_++;
-		// Calculate hash for word using a second hashing function.
-		hash_num = doubleHash( word, round );
+		// Calculate group for word using a second hashing function.
+		group = doubleHash( table, word, hash_value, round );
 		// Increment amount of times hashing function was called.
 		++round;
-	} while( !isFree( hash_num ) );
 
-	// Return free space in hash table.
-	return hash_num;
+		free_positions = matchTag( table, group, EMPTY ) | matchTag( table, group, DELETED );
+	}
+
+	// Return lowest free position in group.
+	return group * GROUP_SIZE + __builtin_ctz( free_positions );
 }
 
-bool StringHashTable::isFree( unsigned key )
+void StringHashTable::placeRobinHood( Table &table, Slot slot )
 {
-	// Return true if space is free or false otherwise.
-	return getData( key ) == nullptr;
-}
+	// Start at word's home position.
+	unsigned position = home( table, slot.hash );
+	// Distance of word being placed from its home position.
+	unsigned distance_from_home = 0;
 
+	// Move forward until a free position is found.
+	while( table.control[ position ] != EMPTY )
+	{
+		// Increment number of collisions.
+		this->collisions_++;
 
-bool StringHashTable::checkIfPrime( unsigned num )
-{
-	// Indicate if number is prime.
-   bool is_prime = true;
+		// A word closer to its home gives its position up and is placed further on instead.
+		unsigned resident_distance = distance( table, position );
+		if( resident_distance < distance_from_home )
+		{
+			Slot resident = table.slots[ position ];
+			setSlot( table, position, slot );
 
-   unsigned i = 2;  // Counter.
-   // Check by exhaustive search if num is prime.
-   while( i < num && is_prime )
-   {
-      if( num % i == 0 )
-         is_prime = false;
+			slot = resident;
+			distance_from_home = resident_distance;
+		}
 
-      ++i;
-   }
+		position = next( table, position );
+		++distance_from_home;
+	}
 
-   return is_prime;
+	// Place last word carried in the free position.
+	setSlot( table, position, slot );
 }
 
-unsigned StringHashTable::findNextPrime( unsigned num )
+void StringHashTable::shiftBackward( Table &table, unsigned position )
 {
-	// Search exhaustively for prime number.
-   while( !checkIfPrime( num ) )
-      ++num;
+	// Position after the one being freed.
+	unsigned following = next( table, position );
 
-   return num;
+	// Shift back every following word until a free position or a word at its home is reached.
+	while( table.control[ following ] != EMPTY && distance( table, following ) > 0 )
+	{
+		setSlot( table, position, table.slots[ following ] );
+
+		position = following;
+		following = next( table, following );
+	}
+
+	// Last position shifted from is free now.
+	table.slots[ position ] = Slot{ 0, 0, FREE_ENTRY };
+	table.control[ position ] = EMPTY;
 }
 
-void StringHashTable::rehash()
+unsigned StringHashTable::home( const Table &table, uint64_t hash_value )
 {
-	// Hash table's original size.
-	unsigned old_size = getSize();
+	// Return h( word ) reduced to amount of positions (a power of two or 16 times a prime).
+	return this->capacity_.reduce( hash_value, table.slots.size() );
+}
 
-	// Calculate prime number closer to getSize() * 2.
-	unsigned new_size = findNextPrime( getSize() * 2 );
+unsigned StringHashTable::distance( const Table &table, unsigned position )
+{
+	// Home position of word at given position.
+	unsigned word_home = home( table, table.slots[ position ].hash );
 
-	// Double hash table's size.
-	this->table_.reserve( new_size );
-	this->table_.resize( new_size );
+	// Return distance, wrapping around the table's end.
+	return position >= word_home ? position - word_home : position + table.slots.size() - word_home;
+}
 
-	// AVL Tree to indicate already reinserted elements.
-	AvlTree reinserted( SortBy::SCORE );
+unsigned StringHashTable::next( const Table &table, unsigned position )
+{
+	// Return following position, wrapping around the table's end.
+	return position + 1 == table.slots.size() ? 0 : position + 1;
+}
 
-	// Recalculate hashing function for each satellite data.
-	for( unsigned i = 0; i < old_size; ++i )
-	{
-		// If there's an element in this position and it wasn't reinserted, reinsert it.
-		if( !isFree( i ) && !reinserted.search( getData( i ) ) )
-			reinsert( i, reinserted );
+unsigned StringHashTable::getGroupsAmount( const Table &table )
+{
+	// Return amount of groups of positions.
+	return table.control.size() / GROUP_SIZE;
+}
 
-		// If there's no element in this position, but it was previously occupied, clear it.
-		else if( isFree( i ) && getData( i ) == nullptr )
-			clear( i );
-	}
+uint8_t StringHashTable::tag( uint64_t hash_value )
+{
+	// Tag is made of the 7 highest bits, so it never looks like a special control byte.
+	return hash_value >> 57;
 }
 
-void StringHashTable::reinsert( unsigned key, AvlTree &reinserted )
+unsigned StringHashTable::matchTag( const Table &table, unsigned group, uint8_t tag )
 {
-	// Copy of data to be reinserted.
-	StringHashData *data_copy = getData( key );
-	// Amount of times hashing function was called.
-	unsigned round = 1;
+	// Group's first control byte.
+	const uint8_t *control = &table.control[ group * GROUP_SIZE ];
+
+#ifdef __SSE2__
+	// Compare all 16 control bytes with tag at once; movemask gathers one bit per byte.
+	__m128i bytes = _mm_loadu_si128( reinterpret_cast< const __m128i* >( control ) );
+	__m128i matches = _mm_cmpeq_epi8( bytes, _mm_set1_epi8( static_cast< char >( tag ) ) );
+
+	return static_cast< unsigned >( _mm_movemask_epi8( matches ) );
+#else
+	// Compare control bytes one by one.
+	unsigned matches = 0;
+	for( unsigned i = 0; i < GROUP_SIZE; ++i )
+		if( control[ i ] == tag )
+			matches |= 1u << i;
+
+	return matches;
+#endif
+}
 
-	// Completely remove data from the hash table at key.
-	setData( nullptr, key );
+void StringHashTable::rehash( unsigned groups )
+{
+	// If a previous rehash is still being moved, finish it first.
+	if( isRehashing() )
+		migrate( getGroupsAmount( this->old_table_ ) );
 
-	// Calculate hashing function for word at position key.
-	unsigned hash_num = hash( data_copy->getWord() );
+	// Current table becomes the old one; satellite data stays where it is.
+	this->old_table_ = std::move( this->table_ );
+	allocate( this->table_, groups );
+	this->migrated_groups_ = 0;
 
-	// Indicate data was reinserted.
-	bool was_reinserted = false;
+	// Count rehash and sample occupation that triggered it.
+	this->stats_.recordRehash( getUsedAmount(), this->old_table_.slots.size() );
+
+	// Tombstones aren't moved to the new table.
+	this->tombstones_ = 0;
+
+	// Recalculate maximum rate of occupation for the new size.
+	calculateMaxRate();
 
-	while( !was_reinserted )
+	// Full rehashing moves every group right away.
+	if( getRehashMode() == RehashMode::FULL )
+		migrate( getGroupsAmount( this->old_table_ ) );
+}
+
+void StringHashTable::migrate( unsigned groups )
+{
+	// Last group to be moved now.
+	unsigned last_group = min( this->migrated_groups_ + groups, getGroupsAmount( this->old_table_ ) );
+
+	// Reinsert metadata of each occupied position using its stored hash value.
+	for( ; this->migrated_groups_ < last_group; ++this->migrated_groups_ )
 	{
-		// If calculated position is free, insert data.
-		if( isFree( hash_num ) )
+		for( unsigned i = 0; i < GROUP_SIZE; ++i )
 		{
-			setData( data_copy, hash_num );
+			unsigned old_position = this->migrated_groups_ * GROUP_SIZE + i;
 
-			// Indicate data has been reinserted.
-			reinserted.insert( getData( hash_num ) );
-			was_reinserted = true;
-		}
+			// Only positions holding a tag are occupied (tombstones are dropped).
+			if( this->old_table_.control[ old_position ] >= EMPTY )
+				continue;
 
-		// If it is occupied, check if data in position hasn't been reinserted.
-		else if( !reinserted.search( getData( hash_num ) ) )
-			reinsert( hash_num, reinserted );
+			const Slot &slot = this->old_table_.slots[ old_position ];
 
-		// Otherwise, it is occupied and a collision occurred - recalculate hash value.
-		else
-		{
-			hash_num = doubleHash( data_copy->getWord(), round );
-			++round;
+			// Robin Hood tables place metadata by linear probing.
+			if( getProbingMode() == ProbingMode::ROBIN_HOOD )
+				placeRobinHood( this->table_, slot );
+			else
+			{
+				// POLYNOMIAL policy needs the word itself, SEEDED policy only the hash value.
+				unsigned position = ( getHashPolicy() == HashPolicy::POLYNOMIAL ) ?
+						solveCollision( this->table_, getData( slot.entry )->getWord(), slot.hash ) :
+						solveCollision( this->table_, string_view(), slot.hash );
+
+				// A word removed from the new table may have left this position.
+				if( this->table_.control[ position ] == DELETED )
+					this->tombstones_--;
+
+				setSlot( this->table_, position, slot );
+			}
+
+			// Position was moved, but searches in old table must keep probing past it.
+			this->old_table_.control[ old_position ] = DELETED;
 		}
 	}
+
+	// Once every group was moved, release old table.
+	if( this->migrated_groups_ == getGroupsAmount( this->old_table_ ) )
+	{
+		this->old_table_ = Table();
+		this->migrated_groups_ = 0;
+	}
+}
+
+void StringHashTable::recordPause( std::chrono::steady_clock::time_point start )
+{
+	// Time spent since start.
+	double pause = chrono::duration< double, micro >( chrono::steady_clock::now() - start ).count();
+
+	// Add it to time spent rehashing, keeping the longest one.
+	this->stats_.recordPause( pause );
 }
 
 void StringHashTable::calculateMaxRate()
 {
-	// Calculate 70% of hash table's size rounded down.
-	double num_of_elements = floor( getSize() * 0.7 );
+	// Calculate maximum load factor of hash table's size rounded down.
+	double num_of_elements = floor( getSize() * this->capacity_.getMaxLoad() );
 
 	// Calculate hash table's maximum rate of occupation.
 	this->max_rate_ = num_of_elements / getSize();
@@ -1,6 +1,34 @@
 /**
  * Definitions of StringHashTable class - a hash table for strings.
  *
+ * The table is flat: each position holds only a small record with the word's hash
+ * value, its length and the index of its satellite data, all stored contiguously.
+ * Satellite data lives in a side array and is only read when hash value and length
+ * match, so most probes stay inside the contiguous array of positions. Words' characters
+ * are kept back to back in a WordArena, and a word's key doubles as its dense 32-bit id.
+ *
+ * Positions are split in groups of 16. A control byte per position holds a 7-bit tag
+ * taken from the word's hash value (or marks the position as free), so a whole group
+ * is compared against a word's tag with a single SSE2 instruction, and only positions
+ * whose tag matches have their metadata checked. Double Hashing moves between groups.
+ * Amounts of groups (primes or powers of two) and the maximum load factor come from a
+ * TableCapacity policy chosen at construction.
+ *
+ * Rehashing may be incremental: the old table is kept beside the new one and a few of
+ * its groups are moved on every insertion or search, so no single operation pays for
+ * moving the whole table.
+ *
+ * Removing a word leaves a tombstone (DELETED control byte) that keeps searches going
+ * and is reused by later insertions. Tombstones count as occupied space, so a table
+ * full of them is rebuilt at the same size, dropping them; compact() does so on demand.
+ *
+ * Alternatively, a table may use Robin Hood linear probing, chosen at construction:
+ * positions are checked one after another from the word's home position, and an inserted
+ * word takes the place of any word closer to its own home. Distances from home stay
+ * short and even, a search stops as soon as it reaches a word closer to home than the
+ * one searched for would be, and removal shifts following words back instead of leaving
+ * a tombstone.
+ *
  *  Created on: July 7th, 2017
  *     Authors: Aline Weber
  *              Renan Kummer
@@ -11,8 +39,32 @@
 
 // Libraries:
 #include <string>
+#include <string_view>
 #include <vector>
-#include "AvlTree.h"
+#include <deque>
+#include <chrono>
+#include <cstdint>
+#include "StringHashData.h"
+#include "StringHasher.h"
+#include "HashTableStats.h"
+#include "TableCapacity.h"
+#include "WordArena.h"
+
+
+/**
+ * Enumerator to be used as argument to define how a table is rehashed.
+ *  FULL        Whole table is moved by the insertion that fills it.
+ *  INCREMENTAL Old table is moved a few groups at a time by later operations.
+ */
+enum RehashMode { FULL, INCREMENTAL };
+
+/**
+ * Enumerator to be used as argument to define how a table looks for a word's position.
+ *  DOUBLE_HASHING Groups of 16 positions compared at once, Double Hashing between groups.
+ *  ROBIN_HOOD     Linear probing, one position at a time, keeping words sorted by distance
+ *                 from their home position.
+ */
+enum ProbingMode { DOUBLE_HASHING, ROBIN_HOOD };
 
 
 class StringHashTable {
@@ -20,8 +72,15 @@ public:
 	/**
 	 * Constructor: create hash table with given size and initialize ranking trees.
 	 *  @param size Hash table's initial size.
+	 *  @param policy Hashing function to be used (seeded 64-bit by default).
+	 *  @param seed Seed for the hashing function.
+	 *  @param capacity Amounts of groups allowed (primes by default).
+	 *  @param max_load Maximum rate of occupied space before rehashing.
+	 *  @param probing How positions are probed (Double Hashing between groups by default).
 	 */
-	StringHashTable( unsigned size );
+	StringHashTable( unsigned size, HashPolicy policy = HashPolicy::SEEDED, uint64_t seed = 0,
+			CapacityPolicy capacity = CapacityPolicy::PRIME_TABLE, double max_load = 0.7,
+			ProbingMode probing = ProbingMode::DOUBLE_HASHING );
 
 	/**
 	 * Insert string in hash table at given index.
@@ -32,7 +91,21 @@ public:
 	 *  @return True if inserted, false otherwise.
 	 *  @attention May call solveCollision() or rehash() methods.
 	 */
-	bool insert( std::string word, double phrase_score, unsigned index, unsigned *key = nullptr );
+	bool insert( std::string_view word, double phrase_score, unsigned index, unsigned *key = nullptr );
+
+	/**
+	 * Find string in hash table, inserting it if it's missing, using a hash value calculated
+	 * by hashOf() beforehand.
+	 *  @param word Word to be found or inserted.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param phrase_score Word's score in the phrase (used only if inserted).
+	 *  @param index Phrase's index (used only if inserted).
+	 *  @param is_inserted Indicate if word was inserted (optional).
+	 *  @return Word's key, valid for as long as the table exists.
+	 *  @attention May call solveCollision() or rehash() methods.
+	 */
+	unsigned findOrInsert( std::string_view word, uint64_t hash_value, double phrase_score,
+			unsigned index, bool *is_inserted = nullptr );
 
 	/**
 	 * Search for given string in hash table.
@@ -40,17 +113,52 @@ public:
 	 *  @param key Word's key in the hash table if found (optional).
 	 *  @return True if found, false otherwise.
 	 */
-	bool search( std::string word, unsigned *key = nullptr );
+	bool search( std::string_view word, unsigned *key = nullptr );
+
+	/**
+	 * Search for given string in hash table using a hash value calculated by hashOf()
+	 * beforehand. Never allocates memory.
+	 *  @param word Word to find.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param key Word's key in the hash table if found (optional).
+	 *  @return True if found, false otherwise.
+	 */
+	bool search( std::string_view word, uint64_t hash_value, unsigned *key = nullptr );
 
 	/**
-	 * Remove string from hash table at given index.
+	 * Calculate a word's 64-bit hash value with this table's hashing function.
+	 *  @param word Word to be hashed.
+	 *  @return Hash value, valid for any table with the same hashing function and seed.
+	 */
+	uint64_t hashOf( std::string_view word );
+
+	/**
+	 * Remove string from hash table, leaving a tombstone at its position (in ROBIN_HOOD
+	 * mode, following words are shifted back instead). Its satellite data is released and
+	 * its key may be given to a word inserted later (its characters stay in the arena until
+	 * the table is destroyed).
 	 *  @param word Word to be removed.
 	 */
-	void remove( std::string word );
+	void remove( std::string_view word );
+
+	/**
+	 * Rebuild hash table at the same size, dropping every tombstone so that probe
+	 * sequences get as short as they were before words were removed.
+	 *  @attention Keys remain valid.
+	 */
+	void compact();
+
+	/**
+	 * Grow hash table, if needed, so that a given amount of words fits without rehashing.
+	 * Meant to be called before a bulk load whose vocabulary size is known or estimated.
+	 *  @param amount Amount of words the table must hold (words already in it included).
+	 *  @attention Keys remain valid. Table is moved at once, even in INCREMENTAL mode.
+	 */
+	void reserve( unsigned amount );
 
 	/**
-	 * Get satellite data at position key by reference.
-	 *  @param key Position in hash table.
+	 * Get satellite data with given key by reference.
+	 *  @param key Word's key (index in the array of satellite data, kept when rehashing).
 	 *  @return Pointer to satellite data.
 	 *  @attention This method breaks encapsulation, use it carefully.
 	 */
@@ -68,6 +176,32 @@ public:
 	 */
 	unsigned getUsedAmount();
 
+	/**
+	 * Get amount of keys given so far: every key below it has satellite data, which has no
+	 * word if its word was removed (getWordId() is NO_WORD until the key is reused).
+	 *  @return Amount of keys.
+	 */
+	unsigned getKeysAmount();
+
+	/**
+	 * Get amount of tombstones (positions left by removed words) in hash table.
+	 *  @return Amount of tombstones (always zero in ROBIN_HOOD mode).
+	 */
+	unsigned getTombstonesAmount();
+
+	/**
+	 * Set hash table's maximum rate of occupied space allowed before rehashing.
+	 *  @param max_load Maximum load factor.
+	 *  @return True if valid (greater than 0.0, up to 0.95), false otherwise.
+	 */
+	bool setMaxLoadFactor( double max_load );
+
+	/**
+	 * Get sizing policy in use.
+	 *  @return Sizing policy.
+	 */
+	CapacityPolicy getCapacityPolicy();
+
 	/**
 	 * Get hash table's maximum rate of occupied space allowed before rehashing.
 	 *  @return Maximum rate of occupation.
@@ -86,76 +220,250 @@ public:
 	 */
 	unsigned getCollisionsNum();
 
+	/**
+	 * Get hashing function in use.
+	 *  @return Hashing function.
+	 */
+	HashPolicy getHashPolicy();
+
+	/**
+	 * Get hashing function in use, with its seed.
+	 *  @return Hashing function.
+	 */
+	const StringHasher& getHasher();
+
+	/**
+	 * Count how many groups must be checked to find a word (or to find out it's missing).
+	 *  @param word Word to find.
+	 *  @return Amount of groups checked (positions in ROBIN_HOOD mode).
+	 */
+	unsigned getProbeLength( std::string_view word );
+
+	/**
+	 * Get how positions are probed.
+	 *  @return Probing mode.
+	 */
+	ProbingMode getProbingMode();
+
+	/**
+	 * Set how the table is rehashed from now on.
+	 *  @param mode FULL or INCREMENTAL rehashing.
+	 *  @attention A migration in progress is finished first when switching to FULL.
+	 */
+	void setRehashMode( RehashMode mode );
+
+	/**
+	 * Get how the table is rehashed.
+	 *  @return Rehashing mode.
+	 */
+	RehashMode getRehashMode();
+
+	/**
+	 * Check if an old table is still being moved to the current one.
+	 *  @return True if rehashing is in progress, false otherwise.
+	 */
+	bool isRehashing();
+
+	/**
+	 * Get amount of times the table was rehashed.
+	 *  @return Number of rehashes.
+	 */
+	unsigned getRehashesNum();
+
+	/**
+	 * Get longest time a single operation spent rehashing.
+	 *  @return Maximum pause in microseconds.
+	 */
+	double getMaxPause();
+
+	/**
+	 * Get counters of lookups (probes of hits and misses) and rehashes, along with current
+	 * occupation and memory used. Lookups are counted by search() and insertions.
+	 *  @return Copy of counters.
+	 */
+	HashTableStats getStats();
+
 private:
 	/**
-	 * Set satellite data to key position.
-	 *  @param data Satellite data to be inserted.
-	 *  @param key Position in hash table.
+	 * Position of the hash table: word's metadata and index of its satellite data.
+	 */
+	struct Slot {
+		uint64_t hash;    // Word's 64-bit hash value (fingerprint).
+		uint32_t length;  // Word's length.
+		uint32_t entry;   // Index of satellite data in entries_, FREE_ENTRY if free.
+	};
+
+	/**
+	 * Arrays of a table: control bytes and positions, both split in groups.
+	 */
+	struct Table {
+		std::vector< uint8_t > control;  // Control bytes: tag of each position, EMPTY or DELETED.
+		std::vector< Slot > slots;       // Positions.
+	};
+
+	/**
+	 * Search for given string in one of the tables using an already calculated hash value.
+	 *  @param table Table to search (current or old one).
+	 *  @param word Word to find.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param probes Amount of groups checked (optional).
+	 *  @return Word's position in table if found, NOT_FOUND otherwise.
+	 */
+	unsigned locate( const Table &table, std::string_view word, uint64_t hash_value,
+			unsigned *probes = nullptr );
+
+	/**
+	 * Search for given string in one of the tables by Robin Hood linear probing.
+	 *  @param table Table to search (current or old one).
+	 *  @param word Word to find.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param probes Amount of positions checked (optional).
+	 *  @return Word's position in table if found, NOT_FOUND otherwise.
+	 */
+	unsigned locateRobinHood( const Table &table, std::string_view word, uint64_t hash_value,
+			unsigned *probes = nullptr );
+
+	/**
+	 * Search for given string in current and old tables using an already calculated hash value.
+	 *  @param word Word to find.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param key Word's key in the hash table if found (optional).
+	 *  @param probes Amount of groups checked (optional).
+	 *  @return True if found, false otherwise.
+	 */
+	bool find( std::string_view word, uint64_t hash_value, unsigned *key = nullptr,
+			unsigned *probes = nullptr );
+
+	/**
+	 * Place a word's metadata at a given position.
+	 *  @param table Table where metadata is placed.
+	 *  @param position Position in table.
+	 *  @param slot Word's metadata.
 	 */
-	void setData( StringHashData *data, unsigned key );
+	void setSlot( Table &table, unsigned position, const Slot &slot );
 
 	/**
-	 * Clear hash table at position key.
-	 *  @param key Position to be cleared.
+	 * Allocate a table with a given amount of groups, all of them free.
+	 *  @param table Table to be allocated.
+	 *  @param groups Amount of groups.
 	 */
-	void clear( unsigned key );
+	void allocate( Table &table, unsigned groups );
 
 	/**
-	 * Hashing function for a given string.
-	 *  @param word String to be inserted in hash table.
-	 *  @return Index for insertion in hash table.
+	 * Hashing function for a given string's hash value.
+	 *  @param table Table where group is calculated.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @return Group for insertion in table.
 	 */
-	unsigned hash( std::string word );
+	unsigned hash( const Table &table, uint64_t hash_value );
 
 	/**
 	 * A second hashing function for a given string.
-	 *  @param word Word to calculate hashing function.
+	 *  @param table Table where group is calculated.
+	 *  @param word Word to calculate hashing function (used by POLYNOMIAL policy only).
+	 *  @param hash_value Word's 64-bit hash value.
 	 *  @param round Amount of times hashing function was called so far.
-	 *  @return Index for insertion in hash table.
+	 *  @return Group for insertion in table.
 	 */
-	unsigned doubleHash( std::string word, unsigned round );
+	unsigned doubleHash( const Table &table, std::string_view word, uint64_t hash_value,
+			unsigned round );
 
 	/**
-	 * Find a free space to insert data using Double Hashing.
+	 * Find a free space to insert data using Double Hashing (first free position or
+	 * tombstone of the first group that has one).
+	 *  @param table Table where space is searched for.
 	 *  @param word Word to recalculate hashing function.
-	 *  @return Key to a free space.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @return Position of a free space.
 	 */
-	unsigned solveCollision( std::string word );
+	unsigned solveCollision( Table &table, std::string_view word, uint64_t hash_value );
 
 	/**
-	 * Check if hash table at a given key is free.
-	 *  @param key Hash table's key to check.
-	 *  @return True if space is free, false otherwise.
+	 * Place a word's metadata by Robin Hood linear probing: every word met that is closer
+	 * to its home position than the one being placed gives its position up and is placed
+	 * further on instead.
+	 *  @param table Table where metadata is placed.
+	 *  @param slot Word's metadata.
 	 */
-	bool isFree( unsigned key );
+	void placeRobinHood( Table &table, Slot slot );
 
 	/**
-	 * Check if a given number is prime.
-	 *  @param num Number to check.
-	 *  @return True if number is prime, false otherwise.
+	 * Free a position of a Robin Hood table, shifting each following word that isn't at its
+	 * home position back by one, so no tombstone is needed.
+	 *  @param table Table where position is freed.
+	 *  @param position Position to be freed.
 	 */
-	bool checkIfPrime( unsigned num );
+	void shiftBackward( Table &table, unsigned position );
 
 	/**
-	 * Find prime number that is at the same time greater than and closer to
-	 * a given number.
-	 *  @param num Number to start search.
-	 *  @return Prime number greater than and closer to num.
+	 * Calculate a word's home position (first one probed in ROBIN_HOOD mode).
+	 *  @param table Table where position is calculated.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @return Home position.
 	 */
-	unsigned findNextPrime( unsigned num );
+	unsigned home( const Table &table, uint64_t hash_value );
 
 	/**
-	 * Reallocate the entire hash table. Operation has a high cost and should be used
-	 * only if used_rate is ~0.7.
+	 * Calculate how far an occupied position is from its word's home position.
+	 *  @param table Table where position is.
+	 *  @param position Occupied position (or one left by a removed word, which keeps its
+	 *                  hash value).
+	 *  @return Distance, in positions, wrapping around the table's end.
 	 */
-	void rehash();
+	unsigned distance( const Table &table, unsigned position );
 
 	/**
-	 * Reinsert satellite data at given key while rehashing.
-	 *  @param key Hash table's key to data.
-	 *  @param reinserted Tree of already reinserted data.
+	 * Get position following a given one, wrapping around the table's end.
+	 *  @param table Table where position is.
+	 *  @param position Current position.
+	 *  @return Next position.
 	 */
-	void reinsert( unsigned key, AvlTree &reinserted );
+	unsigned next( const Table &table, unsigned position );
+
+	/**
+	 * Get amount of groups of positions of a table.
+	 *  @param table Table to check.
+	 *  @return Amount of groups.
+	 */
+	unsigned getGroupsAmount( const Table &table );
+
+	/**
+	 * Get 7-bit tag stored in control bytes for a given hash value.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @return Tag (0 ~ 127).
+	 */
+	uint8_t tag( uint64_t hash_value );
+
+	/**
+	 * Compare all control bytes of a group with a given value.
+	 *  @param table Table where group is.
+	 *  @param group Group to compare.
+	 *  @param tag Value to compare with (a tag or EMPTY).
+	 *  @return Bit mask with bit i set if group's i-th control byte is equal to tag.
+	 */
+	unsigned matchTag( const Table &table, unsigned group, uint8_t tag );
+
+	/**
+	 * Allocate a new table and start moving positions to it, leaving tombstones behind.
+	 * In FULL mode every position is moved immediately; in INCREMENTAL mode, a few groups
+	 * per operation.
+	 *  @param groups New table's amount of groups.
+	 *  @attention Satellite data isn't moved, so keys remain valid.
+	 */
+	void rehash( unsigned groups );
+
+	/**
+	 * Move a given amount of groups from old table to current table, releasing old
+	 * table once all of them have been moved.
+	 *  @param groups Amount of groups to move.
+	 */
+	void migrate( unsigned groups );
+
+	/**
+	 * Record time spent rehashing by current operation.
+	 *  @param start Moment rehashing work started.
+	 */
+	void recordPause( std::chrono::steady_clock::time_point start );
 
 	/**
 	 * Calculate optimal percentage of occupation to rehash.
@@ -165,10 +473,32 @@ private:
 
 // Attributes:
 	unsigned amount_of_data_;  // Amount of data stored in the hash table.
+	unsigned tombstones_;      // Amount of positions left by removed words.
 	unsigned collisions_;      // Number of collisions.
 	double max_rate_;          // Maximum rate of occupation.
 
-	std::vector< StringHashData* > table_;
+	StringHasher hasher_;      // Hashing function.
+	TableCapacity capacity_;   // Sizing policy and maximum load factor.
+
+	Table table_;                          // Current table.
+	Table old_table_;                      // Table being moved while rehashing (empty otherwise).
+	std::deque< StringHashData > entries_; // Satellite data, indexed by key (word's id).
+	WordArena words_;                      // Characters of every word inserted.
+	std::vector< unsigned > free_keys_;    // Keys of removed words, to be reused.
+
+	RehashMode rehash_mode_;    // How the table is rehashed.
+	ProbingMode probing_mode_;  // How positions are probed.
+	unsigned migrated_groups_;  // Groups of old table already moved.
+
+	HashTableStats stats_;      // Counters of lookups and rehashes.
+
+	static constexpr uint32_t FREE_ENTRY = 0xFFFFFFFF;  // Entry of a free position.
+	static constexpr unsigned NOT_FOUND = 0xFFFFFFFF;   // Position of a missing word.
+	static constexpr uint8_t EMPTY = 0x80;              // Control byte of a free position.
+	static constexpr uint8_t DELETED = 0xFE;            // Control byte of a tombstone: position
+	                                                    // that was occupied (keeps probing going).
+	static constexpr unsigned GROUP_SIZE = 16;          // Positions compared at once.
+	static constexpr unsigned MIGRATION_GROUPS = 4;     // Groups moved per operation.
 };
 
 #endif /* STRINGHASHTABLE_H_ */
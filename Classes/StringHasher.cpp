@@ -0,0 +1,142 @@
+/**
+ * Class StringHasher member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <cstring>
+#include "StringHasher.h"
+
+using namespace std;
+
+
+// Primes used by the seeded hashing function (same constants as xxHash64).
+static const uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+static const uint64_t PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+// Rotate bits of value to the left.
+static inline uint64_t rotateLeft( uint64_t value, unsigned bits )
+{
+	return ( value << bits ) | ( value >> ( 64 - bits ) );
+}
+
+
+StringHasher::StringHasher( HashPolicy policy, uint64_t seed )
+{
+	this->policy_ = policy;  // Hashing function.
+	this->seed_ = seed;      // Seed.
+}
+
+uint64_t StringHasher::hash( std::string_view word ) const
+{
+	// Hash whole string.
+	return hash( word.data(), word.size() );
+}
+
+uint64_t StringHasher::hash( const char *word, std::size_t length ) const
+{
+	// Call selected hashing function.
+	if( getPolicy() == HashPolicy::POLYNOMIAL )
+		return polynomialHash( word, length );
+
+	return seededHash( word, length );
+}
+
+HashPolicy StringHasher::getPolicy() const
+{
+	// Return hashing function in use.
+	return this->policy_;
+}
+
+uint64_t StringHasher::getSeed() const
+{
+	// Return seed in use.
+	return this->seed_;
+}
+
+uint64_t StringHasher::polynomialHash( const char *word, std::size_t length ) const
+{
+	const uint64_t modulus = 1000000007;  // Large prime to keep values bounded.
+	const uint64_t prime = 7;             // Prime number for polynomial hashing function.
+	uint64_t hash_num = 0;                // Hash result for word = h( word ).
+
+	// Calculate hash for word using each character.
+	for( std::size_t power = 1; power <= length; ++power )
+	{
+		uint64_t prime_raised = prime;
+
+		// Calculate prime raised to power (recomputed for every character).
+		for( std::size_t p = 1; p < power; ++p )
+		{
+			prime_raised *= prime_raised;
+			prime_raised %= modulus;
+		}
+
+		// h( word ) = c * p^i  |  c is a character from word; p is a prime number.
+		hash_num += static_cast< unsigned char >( word[ power - 1 ] ) * prime_raised;
+		hash_num %= modulus;
+	}
+
+	// Return h( word ).
+	return hash_num;
+}
+
+uint64_t StringHasher::seededHash( const char *word, std::size_t length ) const
+{
+	// Initial state depends on seed and length.
+	uint64_t hash_num = getSeed() + PRIME_5 + length;
+
+	// Consume 8 bytes per round.
+	const char *end = word + length;
+	while( end - word >= 8 )
+	{
+		uint64_t block;
+		memcpy( &block, word, sizeof( block ) );
+
+		block *= PRIME_2;
+		block = rotateLeft( block, 31 );
+		block *= PRIME_1;
+
+		hash_num ^= block;
+		hash_num = rotateLeft( hash_num, 27 ) * PRIME_1 + PRIME_4;
+
+		word += 8;
+	}
+
+	// Consume 4 bytes if possible.
+	if( end - word >= 4 )
+	{
+		uint32_t block;
+		memcpy( &block, word, sizeof( block ) );
+
+		hash_num ^= static_cast< uint64_t >( block ) * PRIME_1;
+		hash_num = rotateLeft( hash_num, 23 ) * PRIME_2 + PRIME_3;
+
+		word += 4;
+	}
+
+	// Consume remaining bytes one by one.
+	while( word < end )
+	{
+		hash_num ^= static_cast< unsigned char >( *word ) * PRIME_5;
+		hash_num = rotateLeft( hash_num, 11 ) * PRIME_1;
+
+		++word;
+	}
+
+	// Avalanche: make every input bit affect every output bit.
+	hash_num ^= hash_num >> 33;
+	hash_num *= PRIME_2;
+	hash_num ^= hash_num >> 29;
+	hash_num *= PRIME_3;
+	hash_num ^= hash_num >> 32;
+
+	// Return h( word ).
+	return hash_num;
+}
@@ -0,0 +1,85 @@
+/**
+ * Definitions of StringHasher class - family of hashing functions for strings used
+ * by StringHashTable.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef STRINGHASHER_H_
+#define STRINGHASHER_H_
+
+// Libraries:
+#include <cstdint>
+#include <string_view>
+
+
+/**
+ * Enumerator to be used as argument to define which hashing function a table uses.
+ *  POLYNOMIAL Original polynomial hashing function, O(L²) on word's length.
+ *  SEEDED     Seeded 64-bit hashing function (xxHash-style), O(L) on word's length.
+ */
+enum HashPolicy { POLYNOMIAL, SEEDED };
+
+
+class StringHasher {
+public:
+	/**
+	 * Constructor: select hashing function and seed.
+	 *  @param policy Hashing function to be used.
+	 *  @param seed Seed for SEEDED policy (ignored by POLYNOMIAL).
+	 */
+	StringHasher( HashPolicy policy = HashPolicy::SEEDED, uint64_t seed = 0 );
+
+	/**
+	 * Calculate 64-bit hash value for a given string.
+	 *  @param word String to be hashed.
+	 *  @return Hash value, independent of any table's size.
+	 */
+	uint64_t hash( std::string_view word ) const;
+
+	/**
+	 * Calculate 64-bit hash value for a given sequence of characters.
+	 *  @param word Pointer to first character.
+	 *  @param length Amount of characters.
+	 *  @return Hash value, independent of any table's size.
+	 */
+	uint64_t hash( const char *word, std::size_t length ) const;
+
+	/**
+	 * Get hashing function in use.
+	 *  @return Hashing function.
+	 */
+	HashPolicy getPolicy() const;
+
+	/**
+	 * Get seed in use.
+	 *  @return Seed.
+	 */
+	uint64_t getSeed() const;
+
+private:
+	/**
+	 * Original polynomial hashing function: h( word ) = sum( c * p^i ).
+	 *  @param word Pointer to first character.
+	 *  @param length Amount of characters.
+	 *  @return Hash value modulo 1,000,000,007.
+	 */
+	uint64_t polynomialHash( const char *word, std::size_t length ) const;
+
+	/**
+	 * Seeded hashing function consuming 8 bytes per round.
+	 *  @param word Pointer to first character.
+	 *  @param length Amount of characters.
+	 *  @return Avalanched 64-bit hash value.
+	 */
+	uint64_t seededHash( const char *word, std::size_t length ) const;
+
+
+// Attributes:
+	HashPolicy policy_;  // Hashing function in use.
+	uint64_t seed_;      // Seed for SEEDED policy.
+};
+
+#endif /* STRINGHASHER_H_ */
@@ -0,0 +1,142 @@
+/**
+ * Class TableCapacity member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include "TableCapacity.h"
+
+using namespace std;
+
+
+// Smallest prime not less than 2^(k/4), for k = 0, 1, 2... (each about 19% above the
+// previous one), so a grown table is never more than 19% bigger than twice the old one.
+static const unsigned PRIMES[] = {
+	2, 3, 5, 7, 11, 13, 17, 23,
+	29, 37, 41, 47, 59, 67, 79, 97,
+	109, 131, 157, 191, 223, 257, 307, 367,
+	431, 521, 613, 727, 863, 1031, 1223, 1451,
+	1723, 2053, 2437, 2897, 3449, 4099, 4871, 5801,
+	6899, 8209, 9743, 11587, 13781, 16411, 19489, 23173,
+	27581, 32771, 38971, 46349, 55109, 65537, 77951, 92683,
+	110221, 131101, 155887, 185369, 220447, 262147, 311747, 370759,
+	440893, 524309, 623521, 741457, 881779, 1048583, 1246997, 1482919,
+	1763491, 2097169, 2493949, 2965847, 3526987, 4194319, 4987901, 5931649,
+	7053971, 8388617, 9975803, 11863289, 14107921, 16777259, 19951597, 23726569,
+	28215809, 33554467, 39903197, 47453149, 56431657, 67108879, 79806341, 94906297,
+	112863217, 134217757, 159612679, 189812533, 225726419
+};
+
+// 2^64 divided by the golden ratio: multiplying by it spreads every bit of a hash value
+// into the upper bits, which multiply-shift keeps.
+static const uint64_t GOLDEN_RATIO = 0x9E3779B97F4A7C15ULL;
+
+
+TableCapacity::TableCapacity( CapacityPolicy policy, double max_load )
+{
+	// Sizing policy.
+	this->policy_ = policy;
+
+	// Maximum load factor (standard one if invalid).
+	this->max_load_ = 0.7;
+	setMaxLoad( max_load );
+}
+
+unsigned TableCapacity::roundUp( unsigned groups ) const
+{
+	// A table has at least one group.
+	if( groups <= 1 )
+		return 1;
+
+	// Smallest power of two not less than groups.
+	if( getPolicy() == CapacityPolicy::POWER_OF_TWO )
+		return 1u << ( 32 - __builtin_clz( groups - 1 ) );
+
+	// Smallest prime in the table not less than groups.
+	return nextPrime( groups );
+}
+
+unsigned TableCapacity::grow( unsigned groups ) const
+{
+	// Twice as many groups, rounded up to an allowed amount.
+	return roundUp( groups * 2 );
+}
+
+unsigned TableCapacity::reduce( uint64_t hash_value, unsigned groups ) const
+{
+	// A single group needs no reduction (and a 64-bit shift would be undefined).
+	if( groups <= 1 )
+		return 0;
+
+	// Multiply-shift: keep upper log2( groups ) bits of the product.
+	if( getPolicy() == CapacityPolicy::POWER_OF_TWO )
+		return ( hash_value * GOLDEN_RATIO ) >> ( 64 - __builtin_ctz( groups ) );
+
+	// Modulo by a prime.
+	return hash_value % groups;
+}
+
+unsigned TableCapacity::wrap( uint64_t group, unsigned groups ) const
+{
+	// Powers of two wrap with a mask.
+	if( getPolicy() == CapacityPolicy::POWER_OF_TWO )
+		return group & ( groups - 1 );
+
+	return group % groups;
+}
+
+unsigned TableCapacity::step( uint64_t hash_value, unsigned groups ) const
+{
+	// A table with a single group has a single possible step.
+	if( groups <= 1 )
+		return 1;
+
+	// Any odd step is coprime with a power of two.
+	if( getPolicy() == CapacityPolicy::POWER_OF_TWO )
+		return ( ( hash_value >> 32 ) & ( groups - 1 ) ) | 1;
+
+	// Take step from the upper half of the hash value, in range [1, groups - 1].
+	unsigned step = 1 + ( hash_value >> 32 ) % ( groups - 1 );
+
+	// Advance step until it's coprime with amount of groups (always true for primes).
+	while( gcd( step, groups ) != 1 )
+		step = step % ( groups - 1 ) + 1;
+
+	return step;
+}
+
+bool TableCapacity::setMaxLoad( double max_load )
+{
+	// Some positions must stay free, so unsuccessful searches find an end.
+	if( max_load <= 0.0 || max_load > 0.95 )
+		return false;
+
+	this->max_load_ = max_load;
+	return true;
+}
+
+double TableCapacity::getMaxLoad() const
+{
+	// Return maximum load factor.
+	return this->max_load_;
+}
+
+CapacityPolicy TableCapacity::getPolicy() const
+{
+	// Return sizing policy.
+	return this->policy_;
+}
+
+unsigned TableCapacity::nextPrime( unsigned num )
+{
+	// Binary search in the precomputed table.
+	const unsigned *prime = lower_bound( begin( PRIMES ), end( PRIMES ), num );
+
+	return prime == end( PRIMES ) ? *prev( end( PRIMES ) ) : *prime;
+}
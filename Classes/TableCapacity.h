@@ -0,0 +1,107 @@
+/**
+ * Definitions of TableCapacity class - sizing policy of StringHashTable: which amounts
+ * of groups a table may have, how a hash value is reduced to one of them and how full
+ * a table may get before rehashing.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef TABLECAPACITY_H_
+#define TABLECAPACITY_H_
+
+// Libraries:
+#include <cstdint>
+
+
+/**
+ * Enumerator to be used as argument to define which amounts of groups a table may have.
+ *  PRIME_TABLE  Primes from a precomputed table (about 19% apart); hash values are reduced
+ *               by modulo.
+ *  POWER_OF_TWO Powers of two; hash values are reduced by multiply-shift, with no division.
+ */
+enum CapacityPolicy { PRIME_TABLE, POWER_OF_TWO };
+
+
+class TableCapacity {
+public:
+	/**
+	 * Constructor: select sizing policy and maximum load factor.
+	 *  @param policy Amounts of groups allowed.
+	 *  @param max_load Maximum rate of occupied space before rehashing.
+	 */
+	TableCapacity( CapacityPolicy policy = CapacityPolicy::PRIME_TABLE, double max_load = 0.7 );
+
+	/**
+	 * Get smallest amount of groups allowed that isn't less than a given amount.
+	 *  @param groups Amount of groups needed.
+	 *  @return Amount of groups allowed.
+	 */
+	unsigned roundUp( unsigned groups ) const;
+
+	/**
+	 * Get amount of groups for a table twice as big.
+	 *  @param groups Current amount of groups.
+	 *  @return Amount of groups allowed.
+	 */
+	unsigned grow( unsigned groups ) const;
+
+	/**
+	 * Reduce a hash value to a group.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param groups Amount of groups (allowed by this policy).
+	 *  @return Group in range [0, groups).
+	 */
+	unsigned reduce( uint64_t hash_value, unsigned groups ) const;
+
+	/**
+	 * Wrap a group index past the end of the table back to its start.
+	 *  @param group Group index (possibly greater than amount of groups).
+	 *  @param groups Amount of groups (allowed by this policy).
+	 *  @return Group in range [0, groups).
+	 */
+	unsigned wrap( uint64_t group, unsigned groups ) const;
+
+	/**
+	 * Calculate Double Hashing's step from the upper half of a hash value. The step is
+	 * coprime with amount of groups, so every group is visited.
+	 *  @param hash_value Word's 64-bit hash value.
+	 *  @param groups Amount of groups (allowed by this policy).
+	 *  @return Distance between consecutive groups checked.
+	 */
+	unsigned step( uint64_t hash_value, unsigned groups ) const;
+
+	/**
+	 * Set maximum rate of occupied space before rehashing.
+	 *  @param max_load Maximum load factor.
+	 *  @return True if valid (greater than 0.0, up to 0.95), false otherwise.
+	 */
+	bool setMaxLoad( double max_load );
+
+	/**
+	 * Get maximum rate of occupied space before rehashing.
+	 *  @return Maximum load factor.
+	 */
+	double getMaxLoad() const;
+
+	/**
+	 * Get sizing policy in use.
+	 *  @return Sizing policy.
+	 */
+	CapacityPolicy getPolicy() const;
+
+	/**
+	 * Find smallest prime in the precomputed table that isn't less than a given number.
+	 *  @param num Number to start search.
+	 *  @return Prime number (largest one in the table if num is greater than all of them).
+	 */
+	static unsigned nextPrime( unsigned num );
+
+private:
+// Attributes:
+	CapacityPolicy policy_;  // Amounts of groups allowed.
+	double max_load_;        // Maximum rate of occupation.
+};
+
+#endif /* TABLECAPACITY_H_ */
@@ -0,0 +1,265 @@
+/**
+ * Class TopKeys member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <iostream>
+#include <algorithm>
+#include "TopKeys.h"
+#include "StringHashData.h"
+#include "RankingSink.h"
+
+using namespace std;
+
+
+TopKeys::TopKeys( SortBy order, bool greatest, unsigned capacity )
+{
+	// Empty heap; no word left out yet.
+	this->key_order_ = order;
+	this->greatest_ = greatest;
+	this->capacity_ = capacity;
+	this->left_out_ = Entry{ 0.0, 0, nullptr };
+	this->has_left_out_ = false;
+	this->is_sorted_ = true;
+	this->heap_.reserve( capacity );
+}
+
+void TopKeys::update( StringHashData *data )
+{
+	// Words are found by their ids: words without one aren't kept.
+	uint32_t id = data->getWordId();
+	if( id == StringHashData::NO_WORD || this->capacity_ == 0 )
+		return;
+
+	Entry entry = entryOf( data );
+	if( id >= this->positions_.size() )
+		this->positions_.resize( id + 1, NOT_IN_HEAP );
+
+	// Heap may change: words must be sorted again.
+	this->is_sorted_ = false;
+
+	// Word in the heap: move it according to its new key. If it got weaker than a word
+	// left out, isExact() will tell.
+	uint32_t position = this->positions_[ id ];
+	if( position != NOT_IN_HEAP )
+	{
+		bool is_stronger = isStronger( entry, this->heap_[ position ] );
+		place( position, entry );
+		if( is_stronger )
+			siftDown( position );
+		else
+			siftUp( position );
+	}
+	// Heap not full yet: include word.
+	else if( this->heap_.size() < this->capacity_ )
+	{
+		this->heap_.push_back( entry );
+		place( this->heap_.size() - 1, entry );
+		siftUp( this->heap_.size() - 1 );
+	}
+	// Word stronger than the weakest one: replace it.
+	else if( isStronger( entry, this->heap_.front() ) )
+	{
+		Entry weakest = this->heap_.front();
+		this->positions_[ weakest.id ] = NOT_IN_HEAP;
+		leaveOut( weakest );
+
+		place( 0, entry );
+		siftDown( 0 );
+	}
+	// Otherwise word stays out.
+	else
+		leaveOut( entry );
+}
+
+void TopKeys::remove( StringHashData *data )
+{
+	// Only words in the heap need removal.
+	uint32_t id = data->getWordId();
+	if( id >= this->positions_.size() || this->positions_[ id ] == NOT_IN_HEAP )
+		return;
+
+	// Move last word to removed word's position, then fix its place. With words left out,
+	// the heap is one word short (isExact() will tell).
+	uint32_t position = this->positions_[ id ];
+	this->positions_[ id ] = NOT_IN_HEAP;
+	this->is_sorted_ = false;
+	Entry last = this->heap_.back();
+	this->heap_.pop_back();
+	if( position < this->heap_.size() )
+	{
+		place( position, last );
+		siftUp( position );
+		siftDown( this->positions_[ last.id ] );
+	}
+}
+
+void TopKeys::refill( const std::vector< StringHashData* > &words, StringHashData *next )
+{
+	// Start over with given words.
+	clear();
+	for( unsigned i = 0; i < words.size() && i < this->capacity_; i++ )
+		update( words[ i ] );
+
+	// Words beyond capacity, and the next one, are left out.
+	for( unsigned i = this->capacity_; i < words.size(); i++ )
+		leaveOut( entryOf( words[ i ] ) );
+	if( next != nullptr )
+		leaveOut( entryOf( next ) );
+}
+
+bool TopKeys::get( unsigned amount, std::vector< StringHashData* > &words ) const
+{
+	// Heap can only tell up to its capacity, and only while it's exact.
+	words.clear();
+	if( amount > this->capacity_ || !isExact() )
+		return false;
+
+	// Sort a copy of heap's words, strongest first, if heap changed since last time.
+	if( !this->is_sorted_ )
+	{
+		vector< Entry > sorted( this->heap_ );
+		sort( sorted.begin(), sorted.end(),
+				[ this ]( const Entry &a, const Entry &b ) { return isStronger( a, b ); } );
+
+		this->sorted_.clear();
+		for( auto &e : sorted )
+			this->sorted_.push_back( e.data );
+		this->is_sorted_ = true;
+	}
+
+	// Keep wanted amount.
+	words.assign( this->sorted_.begin(), this->sorted_.begin() + min< size_t >( amount, this->sorted_.size() ) );
+
+	return true;
+}
+
+bool TopKeys::printKeys( unsigned rank_size ) const
+{
+	// Strongest words, if known.
+	vector< StringHashData* > words;
+	if( !get( rank_size, words ) )
+		return false;
+
+	// Amount of digits in rank_size.
+	unsigned digits_amount = 0;
+	for( unsigned size = rank_size; size > 0; size /= 10 )
+		++digits_amount;
+
+	// Print each word with its position.
+	RankingSink sink( cout, SinkFormat::CONSOLE, digits_amount );
+	sink.begin( this->key_order_ );
+	for( auto d : words )
+		sink.write( d );
+	sink.end();
+
+	return true;
+}
+
+bool TopKeys::isExact() const
+{
+	// With no word left out, heap has every word.
+	if( !this->has_left_out_ )
+		return true;
+
+	// Otherwise, heap must be full and its weakest word stronger than any word left out.
+	return this->heap_.size() == this->capacity_ &&
+			!isStronger( this->left_out_, this->heap_.front() );
+}
+
+void TopKeys::clear()
+{
+	// Forget positions of heap's words (others are already NOT_IN_HEAP).
+	for( auto &e : this->heap_ )
+		this->positions_[ e.id ] = NOT_IN_HEAP;
+
+	this->heap_.clear();
+	this->sorted_.clear();
+	this->is_sorted_ = true;
+	this->has_left_out_ = false;
+}
+
+unsigned TopKeys::getCapacity() const
+{
+	// Return amount of words kept.
+	return this->capacity_;
+}
+
+unsigned TopKeys::getSize() const
+{
+	// Return amount of words in the heap.
+	return this->heap_.size();
+}
+
+bool TopKeys::isStronger( const Entry &a, const Entry &b ) const
+{
+	// Compare keys, then ids; reversed when lowest keys are kept.
+	if( a.key != b.key )
+		return this->greatest_ ? a.key > b.key : a.key < b.key;
+
+	return this->greatest_ ? a.id > b.id : a.id < b.id;
+}
+
+TopKeys::Entry TopKeys::entryOf( StringHashData *data ) const
+{
+	// Score or frequency, according to sorting order.
+	double key = ( this->key_order_ == SortBy::SCORE ) ?
+			data->getScore() : static_cast< double >( data->getFrequency() );
+
+	return Entry{ key, data->getWordId(), data };
+}
+
+void TopKeys::place( unsigned position, const Entry &entry )
+{
+	// Store entry and record where it is.
+	this->heap_[ position ] = entry;
+	this->positions_[ entry.id ] = position;
+}
+
+void TopKeys::siftUp( unsigned position )
+{
+	// Swap with parent while parent is stronger.
+	Entry entry = this->heap_[ position ];
+	while( position > 0 )
+	{
+		unsigned parent = ( position - 1 ) / 2;
+		if( !isStronger( this->heap_[ parent ], entry ) )
+			break;
+
+		place( position, this->heap_[ parent ] );
+		position = parent;
+	}
+	place( position, entry );
+}
+
+void TopKeys::siftDown( unsigned position )
+{
+	// Swap with weakest descendant while it's weaker.
+	Entry entry = this->heap_[ position ];
+	unsigned size = this->heap_.size();
+	while( 2 * position + 1 < size )
+	{
+		unsigned child = 2 * position + 1;
+		if( child + 1 < size && isStronger( this->heap_[ child ], this->heap_[ child + 1 ] ) )
+			child++;
+		if( !isStronger( entry, this->heap_[ child ] ) )
+			break;
+
+		place( position, this->heap_[ child ] );
+		position = child;
+	}
+	place( position, entry );
+}
+
+void TopKeys::leaveOut( const Entry &entry )
+{
+	// Keep the strongest word left out.
+	if( !this->has_left_out_ || isStronger( entry, this->left_out_ ) )
+		this->left_out_ = entry;
+
+	this->has_left_out_ = true;
+}
@@ -0,0 +1,167 @@
+/**
+ * Definitions of TopKeys class - the few words with the greatest (or lowest) keys, kept
+ * up to date word by word as their scores and frequencies change.
+ *
+ * Words are kept in a binary heap bounded to a given capacity, weakest word at the root,
+ * so a stronger word replaces it in O(log capacity). Words are compared by key, ties by
+ * word's id (as rankings built at once order them). Each word's position in the heap is
+ * kept in an array indexed by word's id, so a word already in the heap is found in O(1)
+ * and moved up or down when its key changes.
+ *
+ * The heap only knows its own words: if one of them gets weaker than a word left out
+ * (or is removed), the word that should replace it is unknown. The strongest word ever
+ * left out is remembered, and answers are given only while every word in the heap is
+ * stronger than it; otherwise the heap must be refilled from a full ranking. Heap's words
+ * are sorted when first asked for after a change, so repeated queries cost O(amount).
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef TOPKEYS_H_
+#define TOPKEYS_H_
+
+// Libraries:
+#include <cstdint>
+#include <vector>
+#include "AvlTreeNode.h"
+
+
+class TopKeys {
+public:
+	/**
+	 * Constructor: create an empty heap.
+	 *  @param order Sorting order of keys (SCORE or FREQUENCY).
+	 *  @param greatest Indicate if words with the greatest keys are kept (lowest otherwise).
+	 *  @param capacity Amount of words kept.
+	 */
+	TopKeys( SortBy order, bool greatest, unsigned capacity = 100 );
+
+	/**
+	 * Take a word's new key into account (new word, or its key has changed).
+	 *  @param data Word's satellite data.
+	 *  @attention Words without an id (StringHashData::NO_WORD) are ignored.
+	 */
+	void update( StringHashData *data );
+
+	/**
+	 * Remove a word, before its satellite data is released or reused.
+	 *  @param data Word's satellite data.
+	 */
+	void remove( StringHashData *data );
+
+	/**
+	 * Replace heap's contents with the first words of a full ranking.
+	 *  @param words Strongest words, strongest first (up to capacity; extra ones ignored).
+	 *  @param next Strongest word left out (null pointer if there's none).
+	 */
+	void refill( const std::vector< StringHashData* > &words, StringHashData *next );
+
+	/**
+	 * Get the strongest words, if the heap can tell them exactly.
+	 *  @param amount Amount of words wanted.
+	 *  @param words Vector to be filled with words' satellite data, strongest first
+	 *               (emptied first).
+	 *  @return True if words were found, false if amount is greater than capacity or the
+	 *          heap must be refilled.
+	 */
+	bool get( unsigned amount, std::vector< StringHashData* > &words ) const;
+
+	/**
+	 * Print a ranking of the strongest words, if the heap can tell them exactly.
+	 *  @param rank_size How many words can be in the ranking list.
+	 *  @return True if ranking was printed, false if nothing was printed (see get()).
+	 */
+	bool printKeys( unsigned rank_size ) const;
+
+	/**
+	 * Check if every word in the heap is stronger than every word left out.
+	 *  @return True if heap's words are the strongest ones, false otherwise.
+	 */
+	bool isExact() const;
+
+	/**
+	 * Remove every word.
+	 */
+	void clear();
+
+	/**
+	 * Get amount of words kept.
+	 *  @return Capacity.
+	 */
+	unsigned getCapacity() const;
+
+	/**
+	 * Get amount of words in the heap.
+	 *  @return Amount of words.
+	 */
+	unsigned getSize() const;
+
+private:
+	/**
+	 * Word in the heap, with the key it had when it was last updated.
+	 */
+	struct Entry {
+		double key;            // Score or frequency.
+		uint32_t id;           // Word's id.
+		StringHashData *data;  // Word's satellite data.
+	};
+
+	/**
+	 * Compare two words in this heap's direction.
+	 *  @param a A word.
+	 *  @param b Another word.
+	 *  @return True if a is stronger than b (greater key, or greater id for equal keys; the
+	 *          opposite if lowest keys are kept), false otherwise.
+	 */
+	bool isStronger( const Entry &a, const Entry &b ) const;
+
+	/**
+	 * Create an entry with a word's current key.
+	 *  @param data Word's satellite data.
+	 *  @return Entry.
+	 */
+	Entry entryOf( StringHashData *data ) const;
+
+	/**
+	 * Put an entry at a heap's position, recording its position.
+	 *  @param position Heap's position.
+	 *  @param entry Entry.
+	 */
+	void place( unsigned position, const Entry &entry );
+
+	/**
+	 * Move an entry towards the root while it's weaker than its parent.
+	 *  @param position Entry's position.
+	 */
+	void siftUp( unsigned position );
+
+	/**
+	 * Move an entry away from the root while it's stronger than its weakest descendant.
+	 *  @param position Entry's position.
+	 */
+	void siftDown( unsigned position );
+
+	/**
+	 * Remember a word left out of the heap, if it's the strongest one so far.
+	 *  @param entry Word left out.
+	 */
+	void leaveOut( const Entry &entry );
+
+
+// Attributes:
+	std::vector< Entry > heap_;         // Words, weakest at the root.
+	std::vector< uint32_t > positions_; // Position in heap of each word's id (NOT_IN_HEAP if none).
+	mutable std::vector< StringHashData* > sorted_;  // Heap's words, strongest first.
+	mutable bool is_sorted_;            // Indicate if sorted_ follows heap's last change.
+	Entry left_out_;                    // Strongest word left out.
+	bool has_left_out_;                 // Indicate if any word was left out.
+	SortBy key_order_;                  // Sorting order of keys.
+	bool greatest_;                     // Indicate if greatest keys are kept.
+	unsigned capacity_;                 // Amount of words kept.
+
+	static constexpr uint32_t NOT_IN_HEAP = 0xFFFFFFFF;  // Position of a word not in the heap.
+};
+
+#endif /* TOPKEYS_H_ */
@@ -0,0 +1,79 @@
+/**
+ * Class WordArena member-function definitions.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Libraries:
+#include <cstring>
+#include "WordArena.h"
+
+using namespace std;
+
+
+WordArena::WordArena( std::size_t chunk_size )
+{
+	// At least one character per chunk.
+	this->chunk_size_ = chunk_size == 0 ? 1 : chunk_size;
+
+	// No chunk allocated yet.
+	this->free_ = 0;
+	this->used_ = 0;
+	this->allocated_ = 0;
+}
+
+std::string_view WordArena::store( std::string_view word )
+{
+	// Empty words need no characters.
+	if( word.empty() )
+		return string_view();
+
+	// Start of the copy.
+	char *copy;
+
+	// Words longer than a chunk get a chunk of their own, so the current one isn't wasted.
+	if( word.size() > this->chunk_size_ )
+	{
+		this->chunks_.emplace_back( new char[ word.size() ] );
+		this->allocated_ += word.size();
+
+		// Keep current chunk last, so its free characters are still used.
+		copy = this->chunks_.back().get();
+		if( this->chunks_.size() > 1 )
+			swap( this->chunks_.back(), this->chunks_[ this->chunks_.size() - 2 ] );
+	}
+	else
+	{
+		// If last chunk is full, allocate another one.
+		if( word.size() > this->free_ )
+		{
+			this->chunks_.emplace_back( new char[ this->chunk_size_ ] );
+			this->allocated_ += this->chunk_size_;
+			this->free_ = this->chunk_size_;
+		}
+
+		// Copy goes to first free character of last chunk.
+		copy = this->chunks_.back().get() + ( this->chunk_size_ - this->free_ );
+		this->free_ -= word.size();
+	}
+
+	// Copy word's characters.
+	memcpy( copy, word.data(), word.size() );
+	this->used_ += word.size();
+
+	return string_view( copy, word.size() );
+}
+
+std::size_t WordArena::getUsedBytes() const
+{
+	// Return characters stored.
+	return this->used_;
+}
+
+std::size_t WordArena::getAllocatedBytes() const
+{
+	// Return characters allocated.
+	return this->allocated_;
+}
@@ -0,0 +1,60 @@
+/**
+ * Definitions of WordArena class - storage for the characters of every word in a
+ * vocabulary, kept back to back in large chunks.
+ *
+ * Words are copied once and never moved, so views to them stay valid for as long as the
+ * arena exists. Storing a word costs its characters only: no allocation, capacity or
+ * terminator per word.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+#ifndef WORDARENA_H_
+#define WORDARENA_H_
+
+// Libraries:
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+
+class WordArena {
+public:
+	/**
+	 * Constructor: create an empty arena.
+	 *  @param chunk_size Characters allocated at once (longer words get a chunk of their own).
+	 */
+	WordArena( std::size_t chunk_size = 65536 );
+
+	/**
+	 * Copy a word into the arena.
+	 *  @param word Word to be stored.
+	 *  @return View to the stored copy, valid for as long as the arena exists.
+	 */
+	std::string_view store( std::string_view word );
+
+	/**
+	 * Get amount of characters stored.
+	 *  @return Characters stored.
+	 */
+	std::size_t getUsedBytes() const;
+
+	/**
+	 * Get amount of memory allocated for chunks.
+	 *  @return Bytes allocated.
+	 */
+	std::size_t getAllocatedBytes() const;
+
+private:
+// Attributes:
+	std::vector< std::unique_ptr< char[] > > chunks_;  // Chunks of characters.
+	std::size_t chunk_size_;   // Characters per chunk.
+	std::size_t free_;         // Characters still free in last chunk.
+	std::size_t used_;         // Characters stored.
+	std::size_t allocated_;    // Characters allocated.
+};
+
+#endif /* WORDARENA_H_ */
@@ -13,6 +13,7 @@
 // Libraries:
 #include <iostream>
 #include <stack>
+#include <vector>
 #include "../Classes/AvlTreeNode.h"
 
 using namespace std;
@@ -66,6 +67,9 @@ int main()
 			<< "\nd4 = " << root->search( &d4, SCORE )
 			<< endl;
 
+	// getSize() method (root's subtree holds every node).
+	cout << "\nroot->getSize() = " << root->getSize() << endl;
+
 	// remove() method.
 	root = root->remove( &d4, SCORE );
 	root = root->remove( &d1, SCORE );
@@ -88,6 +92,29 @@ int main()
 				<< endl;
 	}
 
+	// isLower() method: equal keys are ordered by word's id, then by address.
+	StringHashData a( "a", 2.0, 7 ), b( "b", 2.0, 9 ), c( "c", 2.0 ), d( "d", 2.0 );
+	cout << "\nisLower(...): a < b = " << AvlTreeNode::isLower( 2.0, &a, 2.0, &b )
+			<< ", b < a = " << AvlTreeNode::isLower( 2.0, &b, 2.0, &a )
+			<< ", (1, b) < (2, a) = " << AvlTreeNode::isLower( 1.0, &b, 2.0, &a )
+			<< ", c < d != d < c = " << ( AvlTreeNode::isLower( 2.0, &c, 2.0, &d ) !=
+					AvlTreeNode::isLower( 2.0, &d, 2.0, &c ) ) << endl;
+
+	// Many data with equal keys: every one is found and removed.
+	vector< StringHashData > equal;
+	equal.reserve( 1000 );
+	for( unsigned i = 0; i < 1000; ++i )
+		equal.emplace_back( "w", 2.0, ( i * 397 ) % 1000 );
+	AvlTreeNode *equal_root = new AvlTreeNode;
+	for( auto &e : equal )
+		equal_root = equal_root->insert( &e, SCORE );
+	bool all_found = true;
+	for( auto &e : equal )
+		all_found = all_found && equal_root->search( &e, SCORE );
+	for( unsigned i = 0; i < 1000 && equal_root != nullptr; ++i )
+		equal_root = equal_root->remove( &equal[ i ], SCORE );
+	cout << "1000 equal keys: all found = " << all_found
+			<< ", all removed = " << ( equal_root == nullptr ) << endl;
 
 	cout << "> AvlTreeNode : end of main()" << endl;
 }
@@ -13,7 +13,12 @@
 // Libraries:
 #include <iostream>
 #include <string>
+#include <sstream>
 #include <stack>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <functional>
 #include "../Classes/AvlTree.h"
 
 using namespace std;
@@ -31,6 +36,34 @@ void printAvlTree( AvlTreeNode *node )
 	cout << node->getKey() << " ";
 }
 
+// Check keys are in order (left-center-right traversal), counting nodes.
+bool isSorted( AvlTreeNode *node, double &last_key, unsigned &nodes )
+{
+	if( node == nullptr )
+		return true;
+
+	if( !isSorted( node->getLeftDescendant(), last_key, nodes ) || node->getKey() < last_key )
+		return false;
+	last_key = node->getKey();
+	++nodes;
+
+	return isSorted( node->getRightDescendant(), last_key, nodes );
+}
+
+// Check subtrees' sizes, returning subtree's size (or -1 if any size is wrong).
+int checkSizes( AvlTreeNode *node )
+{
+	if( node == nullptr )
+		return 0;
+
+	int left = checkSizes( node->getLeftDescendant() );
+	int right = checkSizes( node->getRightDescendant() );
+	if( left < 0 || right < 0 || node->getSize() != static_cast< unsigned >( left + right + 1 ) )
+		return -1;
+
+	return left + right + 1;
+}
+
 
 int main()
 {
@@ -102,8 +135,172 @@ int main()
 				<< endl;
 	}
 
+	// build() method: same data at once, ties by word's id.
+	StringHashData e0( "e0", 3.52, 0 );
+	StringHashData e1( "e1", 3.24, 1 );
+	StringHashData e2( "e2", 3.52, 2 );
+	StringHashData e3( "e3", 3.24, 3 );
+	StringHashData e4( "e4", 3.521, 4 );
+	tree.build( { &e4, &e3, &e2, &e1, &e0 } );
+
+	cout << "\ntree.build(...):\n";
+	printAvlTree( tree.getRoot() );
+	cout << "\nroot's height = " << tree.getRoot()->getHeight()
+			<< "\ne0 = " << tree.search( &e0 )
+			<< "\ne3 = " << tree.search( &e3 )
+			<< "\ne4 = " << tree.search( &e4 ) << '\n';
+	tree.printGreatestKeys( 5 );
+
+	// Change a score (its node's key is outdated now) and build again.
+	e4.recalculateScore( 0.0, 1 );
+	tree.build( { &e0, &e1, &e2, &e3, &e4 } );
+	cout << "after e4's score changed:\n";
+	tree.printLowestKeys( 5 );
+
+	// Enough data to be sorted by several threads.
+	deque< StringHashData > many;
+	vector< StringHashData* > pointers;
+	for( unsigned i = 0; i < 100000; ++i )
+	{
+		many.emplace_back( "w", ( i * 7919 ) % 5, i );
+		for( unsigned j = 0; j < i % 13; ++j )
+			many.back().recalculateScore( ( i + j ) % 5, j );
+		pointers.push_back( &many.back() );
+	}
+	AvlTree big( FREQUENCY );
+	big.build( pointers );
+
+	double last_key = -1.0;
+	unsigned nodes = 0;
+	bool sorted = isSorted( big.getRoot(), last_key, nodes );
+	cout << "\nbig.build(...): " << nodes << " nodes, sorted = " << sorted
+			<< ", root's height = " << big.getRoot()->getHeight()
+			<< ", found = " << big.search( pointers[ 4242 ] ) << endl;
+
+	// Order statistics, compared with sorted frequencies (greatest first).
+	vector< unsigned > frequencies;
+	for( auto data : pointers )
+		frequencies.push_back( data->getFrequency() );
+	sort( frequencies.begin(), frequencies.end(), greater< unsigned >() );
+
+	bool selected = true;
+	for( unsigned rank = 1; rank <= frequencies.size(); rank += 997 )
+		selected = selected && big.select( rank )->getFrequency() == frequencies[ rank - 1 ];
+	unsigned expected_rank = lower_bound( frequencies.begin(), frequencies.end(),
+			pointers[ 4242 ]->getFrequency(), greater< unsigned >() ) - frequencies.begin() + 1;
+	unsigned lower = count_if( frequencies.begin(), frequencies.end(),
+			[]( unsigned f ) { return f < 7; } );
+	unsigned equal = count( frequencies.begin(), frequencies.end(), 7u );
+
+	cout << "big.getSize() = " << big.getSize()
+			<< "\nbig.select(...) matches sorted keys = " << selected
+			<< "\nbig.select( 0 ) = " << big.select( 0 ) << ", big.select( size + 1 ) = " << big.select( 100001 )
+			<< "\nbig.getRank(...) = " << big.getRank( pointers[ 4242 ] ) << " (expected " << expected_rank << ")"
+			<< "\nbig.getPercentile( 7 ) = " << big.getPercentile( 7.0 )
+			<< " (expected " << 100.0 * ( lower + equal / 2.0 ) / frequencies.size() << ")\n";
+
+	vector< StringHashData* > top;
+	big.getGreatestKeys( 3, top );
+	cout << "big.getGreatestKeys( 3, ... ):";
+	for( auto data : top )
+		cout << ' ' << data->getFrequency();
+	big.getLowestKeys( 3, top );
+	cout << "\nbig.getLowestKeys( 3, ... ):";
+	for( auto data : top )
+		cout << ' ' << data->getFrequency();
+	cout << endl;
+
+	// Ranges, both directions: same words as counted, each key in range and in order.
+	bool ranges_correct = true;
+	for( double low : { 0.0, 3.0, 6.5, 12.0 } )
+		for( double high : { 2.0, 7.0, 100.0 } )
+			for( bool descending : { false, true } )
+			{
+				unsigned amount = 0;
+				double last = descending ? high : low;
+				for( auto i = big.getRange( low, high, descending ); i != big.end(); ++i, ++amount )
+				{
+					ranges_correct = ranges_correct && i.getKey() >= low && i.getKey() <= high &&
+							( descending ? i.getKey() <= last : i.getKey() >= last ) &&
+							i.getKey() == ( *i )->getFrequency();
+					last = i.getKey();
+				}
+				unsigned expected = ( low > high ) ? 0 :
+						big.getSize() - big.countLowerKeys( low ) - big.countGreaterKeys( high );
+				ranges_correct = ranges_correct && amount == expected;
+			}
+	cout << "big.getRange(...): ranges correct = " << ranges_correct
+			<< ", empty tree's range is empty = " << ( AvlTree( SCORE ).getRange() == big.end() ) << endl;
+
+	// Sinks: greatest frequencies as CSV and JSON.
+	ostringstream csv, json;
+	RankingSink csv_sink( csv, CSV ), json_sink( json, JSON );
+	big.writeRange( csv_sink, 13.0, 100.0, true, 2 );
+	big.writeRange( json_sink, 13.0, 13.0, true, 1 );
+	cout << "big.writeRange(...) as CSV:\n" << csv.str() << "as JSON: " << json.str();
+
+	// Sizes kept by insertions and removals (with rotations).
+	AvlTree small( FREQUENCY );
+	for( unsigned i = 0; i < 2000; ++i )
+		small.insert( pointers[ ( i * 7919 ) % pointers.size() ] );
+	for( unsigned i = 0; i < 2000; i += 3 )
+		small.remove( pointers[ ( i * 7919 ) % pointers.size() ] );
+	cout << "small: " << small.getSize() << " nodes, sizes correct = "
+			<< ( checkSizes( small.getRoot() ) == static_cast< int >( small.getSize() ) )
+			<< ", getRank( select( 100 ) ) <= 100 = " << ( small.getRank( small.select( 100 ) ) <= 100 ) << endl;
+
+	// clear() releases every node at once; tree is usable again afterwards.
+	small.clear();
+	small.insert( &e0 );
+	small.insert( &e1 );
+	cout << "small.clear(), then 2 insertions: " << small.getSize() << " nodes, sizes correct = "
+			<< ( checkSizes( small.getRoot() ) == 2 ) << endl;
+
+	// Words read again after being ranked: removed under the frequency they were ranked
+	// with (no longer found by search()), then inserted under their new frequency.
+	deque< StringHashData > moved;
+	AvlTree reread( FREQUENCY );
+	for( unsigned i = 0; i < 500; ++i )
+	{
+		moved.emplace_back( "m", i % 5, i );
+		for( unsigned j = 0; j < i % 7; ++j )
+			moved.back().recalculateScore( 2, j );
+		reread.insert( &moved.back() );
+	}
+	bool moves_correct = true;
+	for( unsigned i = 0; i < 500; i += 3 )
+	{
+		unsigned ranked_frequency = moved[ i ].getFrequency();
+		moved[ i ].recalculateScore( 2, i );
+		moves_correct = moves_correct && !reread.search( &moved[ i ] ) &&
+				reread.search( &moved[ i ], ranked_frequency );
+		reread.remove( &moved[ i ], ranked_frequency );
+		reread.insert( &moved[ i ] );
+	}
+	for( auto &data : moved )
+		moves_correct = moves_correct && reread.search( &data );
+	cout << "reread.remove( data, key ): " << reread.getSize() << " nodes, moves correct = "
+			<< moves_correct << ", sizes correct = " << ( checkSizes( reread.getRoot() ) == 500 ) << endl;
+
+	// Pool of nodes: released nodes are reused, slabs are kept after releasing all nodes.
+	AvlTreeNodePool pool( 1000 );
+	vector< AvlTreeNode* > allocated;
+	for( unsigned i = 0; i < 2500; ++i )
+		allocated.push_back( pool.allocate() );
+	size_t bytes = pool.getAllocatedBytes();
+	pool.release( allocated[ 10 ] );
+	bool reused = pool.allocate() == allocated[ 10 ];
+	pool.releaseAll();
+	bool rewound = pool.allocate() == allocated[ 0 ];
+	cout << "\npool: " << bytes / sizeof( AvlTreeNode ) << " nodes allocated for 2500, reused = " << reused
+			<< ", rewound = " << rewound << ", in use = " << pool.getUsedAmount()
+			<< ", same slabs = " << ( pool.getAllocatedBytes() == bytes ) << endl;
+
+	// Rebuilt tree with no data is empty.
+	big.build( {} );
+	cout << "big.build( {} ): empty = " << big.isEmpty() << endl;
 
-	cout << "> AvlTree : end of main()" << endl;
+	cout << "\n> AvlTree : end of main()" << endl;
 }
 
 #endif /* AVLTREE_TEST_ */
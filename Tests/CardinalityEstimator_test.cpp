@@ -0,0 +1,65 @@
+/**
+ * Main function to test CardinalityEstimator class.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Defines which main() function to use.
+#include "MainControl.cpp"
+#ifdef CARDINALITYESTIMATOR_TEST_
+
+// Libraries:
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include "../Classes/CardinalityEstimator.h"
+#include "../Classes/StringHasher.h"
+
+using namespace std;
+
+
+int main()
+{
+	cout << "> CardinalityEstimator : main()" << endl;
+
+	// Testing constructor.
+	CardinalityEstimator e;
+	StringHasher hasher;
+
+	// Testing estimate() method on an empty estimator.
+	cout << fixed << setprecision( 1 )
+			<< "e.getPrecision() = " << e.getPrecision()
+			<< "\nempty.estimate() = " << e.estimate()
+			<< endl;
+
+	// Testing add() method (repetitions change nothing).
+	for( string word : { "semester", "gaming", "budweiser", "studying", "gaming" } )
+		e.add( hasher.hash( word ) );
+	cout << "\ne.add(...): [4 distinct words]\n"
+			<< "e.estimate() = " << e.estimate()
+			<< endl;
+
+	// Testing estimate() method with many words, each one added twice.
+	for( unsigned amount : { 1000u, 100000u, 1000000u } )
+	{
+		e.clear();
+		for( unsigned i = 0; i < 2 * amount; ++i )
+			e.add( hasher.hash( "word" + to_string( i % amount ) ) );
+
+		cout << "\n" << amount << " distinct words: e.estimate() = " << e.estimate()
+				<< " (error " << 100.0 * ( e.estimate() - amount ) / amount << "%)";
+	}
+
+	// Testing a weak hashing function (bits are mixed before use).
+	StringHasher polynomial( HashPolicy::POLYNOMIAL );
+	e.clear();
+	for( unsigned i = 0; i < 100000; ++i )
+		e.add( polynomial.hash( "word" + to_string( i ) ) );
+	cout << "\nPOLYNOMIAL, 100000 distinct words: e.estimate() = " << e.estimate() << endl;
+
+	cout << "> CardinalityEstimator : end of main()" << endl;
+}
+
+#endif /* CARDINALITYESTIMATOR_TEST_ */
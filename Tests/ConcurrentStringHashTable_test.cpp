@@ -0,0 +1,87 @@
+/**
+ * Main function to test ConcurrentStringHashTable class.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Defines which main() function to use.
+#include "MainControl.cpp"
+#ifdef CONCURRENTSTRINGHASHTABLE_TEST_
+
+// Libraries:
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include "../Classes/ConcurrentStringHashTable.h"
+
+using namespace std;
+
+
+int main()
+{
+	cout << "> ConcurrentStringHashTable : main()" << endl;
+
+	// Testing constructor.
+	ConcurrentStringHashTable h( 16, 4 );
+
+	// Testing insert() and search() methods from a single thread.
+	unsigned k0, k1;
+	cout << boolalpha
+			<< "h.insert(...):\n"
+			<< "semester = " << h.insert( "semester", 0, 0, &k0 ) << '\n'
+			<< "gaming   = " << h.insert( "gaming", 4, 0, &k1 ) << '\n'
+			<< "gaming   = " << h.insert( "gaming", 2, 1 ) << '\n'
+			<< "\nh.search(...):\n"
+			<< "semester = " << h.search( "semester" ) << '\n'
+			<< "missing  = " << h.search( "missing" ) << '\n'
+			<< "\nh.getData(...):\n"
+			<< "semester = " << h.getData( k0 )->getWord() << '\n'
+			<< "gaming   = " << h.getData( k1 )->getWord()
+			<< " (frequency " << h.getData( k1 )->getFrequency() << ")"
+			<< endl;
+
+	// Testing insert() from many threads: each one inserts the same 1000 words 10 times.
+	ConcurrentStringHashTable c( 16 );
+	const unsigned threads_amount = 4;
+	vector< thread > threads;
+	for( unsigned t = 0; t < threads_amount; ++t )
+		threads.emplace_back( [ &c, t ]()
+		{
+			for( unsigned round = 0; round < 10; ++round )
+				for( unsigned i = 0; i < 1000; ++i )
+					c.insert( "word" + to_string( i ), 2, t );
+		} );
+	for( auto &worker : threads )
+		worker.join();
+
+	// Every word must be stored once, with every insertion counted.
+	unsigned missing = 0, wrong_frequency = 0;
+	for( unsigned i = 0; i < 1000; ++i )
+	{
+		unsigned key;
+		if( !c.search( "word" + to_string( i ), &key ) )
+			missing++;
+		else if( c.getData( key )->getFrequency() != threads_amount * 10 )
+			wrong_frequency++;
+	}
+
+	cout << "\n" << threads_amount << " threads:\n"
+			<< "c.getUsedAmount() = " << c.getUsedAmount() << '\n'
+			<< "missing           = " << missing << '\n'
+			<< "wrong frequency   = " << wrong_frequency
+			<< endl;
+
+	// Testing remove() method.
+	h.remove( "semester" );
+	cout << "\nh.remove( \"semester\" ):\n"
+			<< "semester = " << h.search( "semester" ) << '\n'
+			<< "h.getUsedAmount() = " << h.getUsedAmount()
+			<< endl;
+
+	cout << "> ConcurrentStringHashTable : end of main()" << endl;
+}
+
+#endif /* CONCURRENTSTRINGHASHTABLE_TEST_ */
@@ -0,0 +1,115 @@
+/**
+ * Main function to test FrozenRanking class.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Defines which main() function to use.
+#include "MainControl.cpp"
+#ifdef FROZENRANKING_TEST_
+
+// Libraries:
+#include <iostream>
+#include <vector>
+#include <sstream>
+#include <deque>
+#include "../Classes/FrozenRanking.h"
+#include "../Classes/AvlTree.h"
+
+using namespace std;
+
+
+int main()
+{
+	cout << "> FrozenRanking : main()" << endl;
+
+	// Data to be ranked (scores are rounded to labels: 4, 3, 4, 3, 4).
+	StringHashData d0( "d0", 3.52, 0 );
+	StringHashData d1( "d1", 3.24, 1 );
+	StringHashData d2( "d2", 3.52, 2 );
+	StringHashData d3( "d3", 3.24, 3 );
+	StringHashData d4( "d4", 3.521, 4 );
+	StringHashData missing( "missing", 2.0, 5 );
+
+	// Testing constructor and build() method.
+	FrozenRanking ranking( SCORE );
+	cout << boolalpha << "empty: isEmpty() = " << ranking.isEmpty()
+			<< ", select( 1 ) = " << ranking.select( 1 )
+			<< ", getPercentile( 3 ) = " << ranking.getPercentile( 3.0 ) << '\n';
+	ranking.build( { &d4, &d3, &d2, &d1, &d0 } );
+
+	// Testing order statistics.
+	cout << "\nranking.build(...): getSize() = " << ranking.getSize()
+			<< "\ncountLowerKeys( 4 ) = " << ranking.countLowerKeys( 4.0 )
+			<< ", countGreaterKeys( 3 ) = " << ranking.countGreaterKeys( 3.0 )
+			<< ", countGreaterKeys( 5 ) = " << ranking.countGreaterKeys( 5.0 )
+			<< "\ngetRank: d0 = " << ranking.getRank( &d0 ) << ", d1 = " << ranking.getRank( &d1 )
+			<< ", missing = " << ranking.getRank( &missing )
+			<< "\nselect( 4 ) = " << ranking.select( 4 )->getWord()
+			<< ", select( 6 ) = " << ranking.select( 6 )
+			<< "\ngetPercentile( 3 ) = " << ranking.getPercentile( 3.0 )
+			<< ", getPercentile( 3.5 ) = " << ranking.getPercentile( 3.5 ) << '\n';
+
+	// Testing printing methods.
+	ranking.printGreatestKeys( 3 );
+	ranking.printLowestKeys( 10 );
+
+	// Same answers as an AVL tree built from the same data (ranges written to sinks too),
+	// with enough data to be sorted by several threads.
+	deque< StringHashData > many;
+	vector< StringHashData* > pointers;
+	for( unsigned i = 0; i < 200000; ++i )
+	{
+		many.emplace_back( "w", ( i * 7919 ) % 5, i );
+		for( unsigned j = 0; j < i % 17; ++j )
+			many.back().recalculateScore( ( i * j ) % 5, j );
+		pointers.push_back( &many.back() );
+	}
+
+	bool same = true;
+	for( SortBy order : { SCORE, FREQUENCY } )
+	{
+		FrozenRanking frozen( order );
+		AvlTree tree( order );
+		frozen.build( pointers );
+		tree.build( pointers );
+
+		for( double key = -0.5; key <= 18.0; key += 0.25 )
+			same = same && frozen.countLowerKeys( key ) == tree.countLowerKeys( key ) &&
+					frozen.countGreaterKeys( key ) == tree.countGreaterKeys( key ) &&
+					frozen.getPercentile( key ) == tree.getPercentile( key );
+		for( unsigned i = 0; i < pointers.size(); i += 101 )
+			same = same && frozen.getRank( pointers[ i ] ) == tree.getRank( pointers[ i ] ) &&
+					frozen.select( i + 1 ) == tree.select( i + 1 );
+
+		vector< StringHashData* > a, b;
+		frozen.getGreatestKeys( 1000, a );
+		tree.getGreatestKeys( 1000, b );
+		same = same && a == b;
+		frozen.getLowestKeys( 1000, a );
+		tree.getLowestKeys( 1000, b );
+		same = same && a == b;
+
+		for( double low : { 0.0, 2.5, 9.0 } )
+			for( bool descending : { false, true } )
+			{
+				ostringstream from_frozen, from_tree;
+				RankingSink frozen_sink( from_frozen, JSON ), tree_sink( from_tree, JSON );
+				frozen.writeRange( frozen_sink, low, low + 3.0, descending, 5000 );
+				tree.writeRange( tree_sink, low, low + 3.0, descending, 5000 );
+				same = same && from_frozen.str() == from_tree.str();
+			}
+	}
+	cout << "\nsame answers as AvlTree (200000 words, both orders) = " << same << endl;
+
+	// Testing clear() method.
+	ranking.clear();
+	cout << "ranking.clear(): isEmpty() = " << ranking.isEmpty()
+			<< ", getAllocatedBytes() = " << ranking.getAllocatedBytes() << endl;
+
+	cout << "> FrozenRanking : end of main()" << endl;
+}
+
+#endif /* FROZENRANKING_TEST_ */
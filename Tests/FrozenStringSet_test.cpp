@@ -0,0 +1,75 @@
+/**
+ * Main function to test FrozenStringSet class.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Defines which main() function to use.
+#include "MainControl.cpp"
+#ifdef FROZENSTRINGSET_TEST_
+
+// Libraries:
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../Classes/FrozenStringSet.h"
+
+using namespace std;
+
+
+int main()
+{
+	cout << "> FrozenStringSet : main()" << endl;
+
+	// Testing constructor.
+	FrozenStringSet s;
+
+	// Testing contains() method on an empty set.
+	cout << boolalpha
+			<< "empty.contains( \"the\" ) = " << s.contains( "the" )
+			<< endl;
+
+	// Testing build() method (repetitions are ignored).
+	cout << "\ns.build(...) = "
+			<< s.build( { "semester", "gaming", "budweiser", "studying", "gaming" } )
+			<< "\ns.getSize()            = " << s.getSize()
+			<< "\ns.getPositionsAmount() = " << s.getPositionsAmount()
+			<< endl;
+
+	// Testing contains() method.
+	cout << "\ns.contains(...):\n"
+			<< "semester  = " << s.contains( "semester" ) << '\n'
+			<< "gaming    = " << s.contains( "gaming" ) << '\n'
+			<< "budweiser = " << s.contains( "budweiser" ) << '\n'
+			<< "studying  = " << s.contains( "studying" ) << '\n'
+			<< "study     = " << s.contains( "study" ) << '\n'
+			<< "(empty)   = " << s.contains( "" )
+			<< endl;
+
+	// Testing build() method with stopwords' file.
+	ifstream file( "Files/stopwords.txt" );
+	vector< string > stopwords;
+	string stopword;
+	while( file >> stopword )
+		stopwords.push_back( stopword );
+
+	s.build( stopwords );
+
+	unsigned found = 0;
+	for( auto &word : stopwords )
+		found += s.contains( word );
+
+	cout << "\nstopwords.txt:\n"
+			<< "s.getSize()            = " << s.getSize()
+			<< "\ns.getPositionsAmount() = " << s.getPositionsAmount()
+			<< "\nfound                  = " << found << " / " << stopwords.size()
+			<< "\nsemester               = " << s.contains( "semester" )
+			<< endl;
+
+	cout << "> FrozenStringSet : end of main()" << endl;
+}
+
+#endif /* FROZENSTRINGSET_TEST_ */
@@ -17,3 +17,10 @@
 //#define TRIENODE_TEST_
 //#define TRIE_TEST_
 //#define STRINGHASHTABLE_TEST_
+//#define STRINGHASHTABLE_BENCH_
+//#define FROZENSTRINGSET_TEST_
+//#define CONCURRENTSTRINGHASHTABLE_TEST_
+//#define CARDINALITYESTIMATOR_TEST_
+//#define FROZENRANKING_TEST_
+//#define TOPKEYS_TEST_
+//#define SCOREFREQUENCYINDEX_TEST_
@@ -0,0 +1,120 @@
+/**
+ * Main function to test ScoreFrequencyIndex class.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Defines which main() function to use.
+#include "MainControl.cpp"
+#ifdef SCOREFREQUENCYINDEX_TEST_
+
+// Libraries:
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <random>
+#include <algorithm>
+#include "../Classes/ScoreFrequencyIndex.h"
+
+using namespace std;
+
+
+/**
+ * Rank words seen at least min_frequency times by score, scanning all (ties by word id,
+ * reversed for greatest scores, as in a descending walk of AvlTree).
+ *  @param words Words to be ranked.
+ *  @param amount Maximum amount of words ranked.
+ *  @param min_frequency Minimum frequency.
+ *  @param greatest Indicate if greatest scores come first (lowest otherwise).
+ *  @return Ranked words.
+ */
+vector< StringHashData* > scan( const vector< StringHashData* > &words, unsigned amount,
+		unsigned min_frequency, bool greatest )
+{
+	vector< StringHashData* > ranked;
+	for( auto d : words )
+		if( d->getFrequency() >= min_frequency )
+			ranked.push_back( d );
+	sort( ranked.begin(), ranked.end(), [ greatest ]( StringHashData *a, StringHashData *b ) {
+		if( a->getScore() != b->getScore() )
+			return greatest ? a->getScore() > b->getScore() : a->getScore() < b->getScore();
+		return greatest ? a->getWordId() > b->getWordId() : a->getWordId() < b->getWordId();
+	} );
+	if( ranked.size() > amount )
+		ranked.resize( amount );
+	return ranked;
+}
+
+int main()
+{
+	cout << "> ScoreFrequencyIndex : main()" << endl;
+
+	// Data to be indexed: frequency is the amount of reviews read.
+	StringHashData d0( "d0", 4, 0 );
+	StringHashData d1( "d1", 0, 1 );
+	StringHashData d2( "d2", 3, 2 );
+	StringHashData d3( "d3", 1, 3 );
+	d0.recalculateScore( 4, 0 );                         // Score 4, frequency 2.
+	for( unsigned i = 0; i < 4; ++i )
+		d1.recalculateScore( 1, 1 );                     // Score 0.8, frequency 5.
+	d2.recalculateScore( 2, 2 );
+	d2.recalculateScore( 1, 2 );                         // Score 2, frequency 3.
+
+	// Testing constructor and build() method.
+	ScoreFrequencyIndex index;
+	cout << boolalpha << "empty: isEmpty() = " << index.isEmpty() << '\n';
+	index.build( { &d0, &d1, &d2, &d3 } );
+	cout << "build( d0 ~ d3 ): getSize() = " << index.getSize()
+			<< ", countWithSupport( 3 ) = " << index.countWithSupport( 3 ) << '\n';
+
+	// Testing getGreatestScores() and getLowestScores() methods.
+	vector< StringHashData* > words;
+	for( unsigned min_frequency : { 0, 3, 5, 6 } )
+	{
+		index.getGreatestScores( 10, min_frequency, words );
+		cout << "getGreatestScores( 10, " << min_frequency << " ) ->";
+		for( auto d : words )
+			cout << ' ' << d->getWord();
+		index.getLowestScores( 2, min_frequency, words );
+		cout << "; getLowestScores( 2, " << min_frequency << " ) ->";
+		for( auto d : words )
+			cout << ' ' << d->getWord();
+		cout << '\n';
+	}
+
+	// Random words with repeated scores and frequencies, against a full scan.
+	mt19937 generator( 17 );
+	deque< StringHashData > data;
+	vector< StringHashData* > all;
+	for( unsigned i = 0; i < 5000; ++i )
+	{
+		data.emplace_back( "w", generator() % 5, i );
+		unsigned repeats = generator() % 3 == 0 ? generator() % 200 : generator() % 5;
+		for( unsigned j = 0; j < repeats; ++j )
+			data.back().recalculateScore( generator() % 5, i );
+		all.push_back( &data.back() );
+	}
+	index.build( all );
+	bool is_same = true;
+	for( unsigned min_frequency : { 0, 1, 2, 5, 50, 150, 1000 } )
+		for( unsigned amount : { 1, 10, 100, 10000 } )
+		{
+			index.getGreatestScores( amount, min_frequency, words );
+			is_same = is_same && words == scan( all, amount, min_frequency, true );
+			index.getLowestScores( amount, min_frequency, words );
+			is_same = is_same && words == scan( all, amount, min_frequency, false );
+		}
+	cout << "same answers as a full scan (5000 words) = " << is_same << '\n';
+
+	// Testing clear() method.
+	index.clear();
+	index.getGreatestScores( 10, 0, words );
+	cout << "clear(): isEmpty() = " << index.isEmpty() << ", words = " << words.size() << '\n';
+
+	cout << "> ScoreFrequencyIndex : end of main()" << endl;
+	return 0;
+}
+
+#endif /* SCOREFREQUENCYINDEX_TEST_ */
@@ -13,6 +13,7 @@
 // Libraries:
 #include <iostream>
 #include <iomanip>
+#include <vector>
 #include "../Classes/StringHashData.h"
 
 using namespace std;
@@ -45,7 +46,7 @@ int main()
 			<< endl;
 
 	// insert() method.
-	D0.insert( "semester", 0.0 );
+	D0.insert( "semester", 0.0, 0 );
 
 	// Print attributes.
 	cout << "\nD0.insert( \"semester\", 0.0 ):\n"
@@ -62,20 +63,67 @@ int main()
 			<< "Data      = " << D0.getWord()
 			<< "\nScore     = " << D0.getScore( true, &score_range ) << " : " << score_range
 			<< "\nFrequency = " << D0.getFrequency()
+			<< "\nIndexes   = " << D0.getIndexes().size()
 			<< endl;
 
 	// recalculate() method.
-	D0.insert( "A", 4.0 );
-	D0.recalculateScore( 3.0 );
-	D0.recalculateScore( 4.0 );
+	D0.insert( "A", 4.0, 0 );
+	D0.recalculateScore( 3.0, 1 );
+	D0.recalculateScore( 4.0, 2 );
 
 	// Print attributes.
 	cout << "\nD0.recalculateScore(...):\n"
 			<< "Data      = " << D0.getWord()
 			<< "\nScore     = " << D0.getScore( true, &score_range ) << " : " << score_range
 			<< "\nFrequency = " << D0.getFrequency()
+			<< "\nVariance  = " << D0.getVariance()
+			<< "\nMedian    = " << D0.getMedian()
+			<< "\nLabels    = " << D0.getLabelCount( 0 ) << ' ' << D0.getLabelCount( 1 ) << ' '
+			<< D0.getLabelCount( 2 ) << ' ' << D0.getLabelCount( 3 ) << ' ' << D0.getLabelCount( 4 )
 			<< endl;
 
+	// Exact aggregation: a mean of 7 / 3 no longer truncates as more occurrences come.
+	StringHashData D2( "exact", 2.0 );
+	D2.recalculateScore( 2.0, 1 );
+	D2.recalculateScore( 3.0, 2 );
+	for( unsigned i = 3; i < 1000; ++i )
+		D2.recalculateScore( i % 3 == 2 ? 3.0 : 2.0, i );
+	cout << "\nD2: 667 x 2.0, 333 x 3.0"
+			<< "\nScore     = " << D2.getScore()
+			<< "\nMedian    = " << D2.getMedian()
+			<< endl;
+
+	// addIndex() through recalculateScore(): repeated and out-of-order indexes.
+	D0.recalculateScore( 2.0, 2 );
+	D0.recalculateScore( 2.0, 300 );
+	D0.recalculateScore( 2.0, 1 );
+	D0.recalculateScore( 2.0, 150 );
+
+	// Print indexes, decoded while iterating.
+	cout << "\nD0.getIndexes() = [";
+	for( auto index : D0.getIndexes() )
+		cout << ' ' << index;
+	cout << " ] (" << D0.getIndexes().size() << " indexes, "
+			<< D0.getIndexes().getEncodedBytes() << " bytes)"
+			<< endl;
+
+	// addPosition() method: positions of word's tokens in reviews 300 and 301.
+	D0.addPosition( 300, 4 );
+	D0.addPosition( 300, 9 );
+	D0.addPosition( 301, 0 );
+
+	vector< unsigned > positions;
+	cout << "\nD0.addPosition(...):";
+	for( auto i = D0.getIndexes().begin(); i != D0.getIndexes().end(); ++i )
+		if( i.hasPositions() )
+		{
+			i.getPositions( positions );
+			cout << "\nreview " << *i << ":";
+			for( auto position : positions )
+				cout << ' ' << position;
+		}
+	cout << endl;
+
 	cout << "> StringHashData : end of main()" << endl;
 }
 
@@ -0,0 +1,756 @@
+/**
+ * Main function to benchmark StringHashTable hashing policies, rehashing modes and
+ * removal, sizing policies and load factors, probing modes, ConcurrentStringHashTable
+ * ingestion, StringHashData's posting lists and rankings.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Defines which main() function to use.
+#include "MainControl.cpp"
+#ifdef STRINGHASHTABLE_BENCH_
+
+// Libraries:
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <thread>
+#include <deque>
+#include <random>
+#include "../Classes/StringHashTable.h"
+#include "../Classes/ConcurrentStringHashTable.h"
+#include "../Classes/ScoreFrequencyIndex.h"
+#include "../Classes/PostingList.h"
+#include "../Classes/AvlTree.h"
+#include "../Classes/FrozenRanking.h"
+#include "../Classes/TopKeys.h"
+
+using namespace std;
+
+
+// Read every token of a reviews' file (lowercase, review scores skipped).
+vector< string > readTokens( string file_name )
+{
+	vector< string > tokens;
+	ifstream file( file_name );
+	string review;
+
+	while( getline( file, review ) )
+	{
+		istringstream line( review );
+		string word;
+
+		// Skip review's score.
+		line >> word;
+
+		while( line >> word )
+		{
+			for( auto &letter : word )
+				letter = tolower( letter );
+			tokens.push_back( word );
+		}
+	}
+
+	return tokens;
+}
+
+// Insert vocabulary, then time lookups of every token and of missing words.
+void benchmark( string name, HashPolicy policy, const vector< string > &tokens,
+		const vector< string > &vocabulary, const vector< string > &missing )
+{
+	// Table just big enough for the vocabulary at its maximum load, so probe lengths show.
+	StringHashTable h( 16, policy );
+	h.reserve( vocabulary.size() );
+
+	// Build table (every token is either inserted or found).
+	auto start = chrono::steady_clock::now();
+	for( auto &word : tokens )
+		h.insert( word, 2, 0 );
+	auto end = chrono::steady_clock::now();
+	double insert_ns = chrono::duration< double, nano >( end - start ).count() / tokens.size();
+
+	// Successful lookups.
+	unsigned found = 0;
+	start = chrono::steady_clock::now();
+	for( auto &word : tokens )
+		found += h.search( word );
+	end = chrono::steady_clock::now();
+	double hit_ns = chrono::duration< double, nano >( end - start ).count() / tokens.size();
+
+	// Unsuccessful lookups.
+	start = chrono::steady_clock::now();
+	for( auto &word : missing )
+		found += h.search( word );
+	end = chrono::steady_clock::now();
+	double miss_ns = chrono::duration< double, nano >( end - start ).count() / missing.size();
+
+	// Probe-length distribution over distinct words (hits) and missing words.
+	map< unsigned, unsigned > hit_probes, miss_probes;
+	for( auto &word : vocabulary )
+		++hit_probes[ h.getProbeLength( word ) ];
+	for( auto &word : missing )
+		++miss_probes[ h.getProbeLength( word ) ];
+
+	cout << "-- " << name << " --\n"
+			<< fixed << setprecision( 1 )
+			<< "words stored   = " << h.getUsedAmount() << " (table size " << h.getSize() << ")\n"
+			<< "collisions     = " << h.getCollisionsNum() << '\n'
+			<< "insert         = " << insert_ns << " ns/token\n"
+			<< "lookup (hit)   = " << hit_ns << " ns/lookup\n"
+			<< "lookup (miss)  = " << miss_ns << " ns/lookup\n"
+			<< "found          = " << found << '\n'
+			<< "probes : hits / misses (load " << setprecision( 2 ) << h.getStats().getLoadFactor()
+			<< ")\n";
+
+	for( unsigned probes = 1; probes <= 8; ++probes )
+		cout << setw( 6 ) << probes << " : "
+				<< setw( 6 ) << hit_probes[ probes ] << " / " << setw( 6 ) << miss_probes[ probes ] << '\n';
+
+	// Accumulate longer probe sequences into last line.
+	unsigned long_hits = 0, long_misses = 0;
+	for( auto &entry : hit_probes )
+		if( entry.first > 8 )
+			long_hits += entry.second;
+	for( auto &entry : miss_probes )
+		if( entry.first > 8 )
+			long_misses += entry.second;
+	cout << "    >8 : " << setw( 6 ) << long_hits << " / " << setw( 6 ) << long_misses << '\n' << endl;
+}
+
+// Grow a table from its smallest size, reporting longest pause of a single insertion.
+void benchmarkRehash( string name, RehashMode mode, const vector< string > &tokens )
+{
+	StringHashTable h( 16 );
+	h.setRehashMode( mode );
+
+	auto start = chrono::steady_clock::now();
+	for( auto &word : tokens )
+		h.insert( word, 2, 0 );
+	auto end = chrono::steady_clock::now();
+
+	cout << "-- " << name << " rehashing --\n"
+			<< fixed << setprecision( 1 )
+			<< "rehashes       = " << h.getRehashesNum() << " (table size " << h.getSize() << ")\n"
+			<< "insert         = " << chrono::duration< double, nano >( end - start ).count() / tokens.size()
+			<< " ns/token\n"
+			<< "maximum pause  = " << h.getMaxPause() << " us\n" << endl;
+}
+
+// Grow a table from its smallest size with a given sizing policy and load factor,
+// reporting throughput and memory.
+void benchmarkCapacity( string name, CapacityPolicy capacity, double max_load,
+		const vector< string > &tokens, const vector< string > &missing )
+{
+	StringHashTable h( 16, HashPolicy::SEEDED, 0, capacity, max_load );
+
+	auto start = chrono::steady_clock::now();
+	for( auto &word : tokens )
+		h.insert( word, 2, 0 );
+	auto end = chrono::steady_clock::now();
+	double insert_ns = chrono::duration< double, nano >( end - start ).count() / tokens.size();
+
+	start = chrono::steady_clock::now();
+	for( auto &word : tokens )
+		h.search( word );
+	end = chrono::steady_clock::now();
+	double hit_ns = chrono::duration< double, nano >( end - start ).count() / tokens.size();
+
+	start = chrono::steady_clock::now();
+	for( auto &word : missing )
+		h.search( word );
+	end = chrono::steady_clock::now();
+	double miss_ns = chrono::duration< double, nano >( end - start ).count() / missing.size();
+
+	HashTableStats stats = h.getStats();
+	cout << fixed << setprecision( 1 )
+			<< setw( 12 ) << name << setw( 7 ) << setprecision( 3 ) << max_load << setprecision( 1 )
+			<< setw( 9 ) << h.getSize() << setw( 8 ) << setprecision( 2 ) << stats.getLoadFactor()
+			<< setprecision( 1 ) << setw( 8 ) << stats.getBytesPerEntry()
+			<< setw( 9 ) << insert_ns << setw( 9 ) << hit_ns << setw( 9 ) << miss_ns << '\n';
+}
+
+// Time lookups of missing words.
+double missTime( StringHashTable &h, const vector< string > &missing )
+{
+	auto start = chrono::steady_clock::now();
+	for( auto &word : missing )
+		h.search( word );
+	auto end = chrono::steady_clock::now();
+
+	return chrono::duration< double, nano >( end - start ).count() / missing.size();
+}
+
+// Remove most of the vocabulary, then compact, reporting unsuccessful lookups' latency.
+void benchmarkRemove( const vector< string > &vocabulary, const vector< string > &missing )
+{
+	StringHashTable h( 100001 );
+	for( auto &word : vocabulary )
+		h.insert( word, 2, 0 );
+	double before_ns = missTime( h, missing );
+
+	// Remove three out of every four words.
+	for( unsigned i = 0; i < vocabulary.size(); ++i )
+		if( i % 4 != 0 )
+			h.remove( vocabulary[ i ] );
+	unsigned tombstones = h.getTombstonesAmount();
+	double removed_ns = missTime( h, missing );
+
+	h.compact();
+	double compacted_ns = missTime( h, missing );
+
+	cout << "-- remove --\n"
+			<< fixed << setprecision( 1 )
+			<< "lookup (miss)  = " << before_ns << " ns/lookup before removal\n"
+			<< "               = " << removed_ns << " ns/lookup with " << tombstones << " tombstones\n"
+			<< "               = " << compacted_ns << " ns/lookup after compact()\n" << endl;
+}
+
+// Grow a table with a given probing mode and load factor, then time lookups before and
+// after removing half of the vocabulary, reporting probes per lookup.
+void benchmarkProbing( string name, ProbingMode probing, double max_load,
+		const vector< string > &tokens, const vector< string > &vocabulary,
+		const vector< string > &missing )
+{
+	StringHashTable h( 16, HashPolicy::SEEDED, 0, CapacityPolicy::POWER_OF_TWO, max_load, probing );
+
+	auto start = chrono::steady_clock::now();
+	for( auto &word : tokens )
+		h.insert( word, 2, 0 );
+	auto end = chrono::steady_clock::now();
+	double insert_ns = chrono::duration< double, nano >( end - start ).count() / tokens.size();
+
+	start = chrono::steady_clock::now();
+	for( auto &word : tokens )
+		h.search( word );
+	end = chrono::steady_clock::now();
+	double hit_ns = chrono::duration< double, nano >( end - start ).count() / tokens.size();
+	double miss_ns = missTime( h, missing );
+
+	// Probes of hits and misses so far (insertions included).
+	HashTableStats stats = h.getStats();
+
+	// Remove every other word.
+	for( unsigned i = 0; i < vocabulary.size(); i += 2 )
+		h.remove( vocabulary[ i ] );
+	double removed_ns = missTime( h, missing );
+
+	cout << fixed << setprecision( 1 )
+			<< setw( 14 ) << name << setw( 7 ) << setprecision( 3 ) << max_load << setprecision( 1 )
+			<< setw( 9 ) << insert_ns << setw( 9 ) << hit_ns << setw( 9 ) << miss_ns
+			<< setw( 10 ) << removed_ns << setprecision( 2 )
+			<< setw( 8 ) << stats.getAverageProbes( true ) << setw( 8 ) << stats.getAverageProbes( false )
+			<< '\n';
+}
+
+// Add each token's review index to its word's posting list, comparing compressed lists
+// with the vectors of indexes they replaced (scanned for repetitions on every addition).
+void benchmarkPostings( string file_name )
+{
+	// Words of each review, in order.
+	vector< vector< string > > reviews;
+	ifstream file( file_name );
+	string review;
+	while( getline( file, review ) )
+	{
+		istringstream line( review );
+		string word;
+		line >> word;
+
+		reviews.emplace_back();
+		while( line >> word )
+		{
+			for( auto &letter : word )
+				letter = tolower( letter );
+			reviews.back().push_back( word );
+		}
+	}
+
+	StringHashTable h( 100001 );
+	vector< PostingList > lists, positional;
+	vector< vector< unsigned > > vectors;
+	unsigned key;
+
+	// Keys of each token.
+	vector< vector< unsigned > > keys( reviews.size() );
+	for( unsigned index = 0; index < reviews.size(); ++index )
+		for( auto &word : reviews[ index ] )
+		{
+			h.insert( word, 2, 0, &key );
+			keys[ index ].push_back( key );
+		}
+	lists.resize( h.getUsedAmount() );
+	positional.resize( h.getUsedAmount() );
+	vectors.resize( h.getUsedAmount() );
+
+	auto start = chrono::steady_clock::now();
+	for( unsigned index = 0; index < keys.size(); ++index )
+		for( auto k : keys[ index ] )
+			lists[ k ].add( index );
+	auto end = chrono::steady_clock::now();
+	double list_ms = chrono::duration< double, milli >( end - start ).count();
+
+	start = chrono::steady_clock::now();
+	for( unsigned index = 0; index < keys.size(); ++index )
+		for( auto k : keys[ index ] )
+			if( find( vectors[ k ].begin(), vectors[ k ].end(), index ) == vectors[ k ].end() )
+				vectors[ k ].push_back( index );
+	end = chrono::steady_clock::now();
+	double vector_ms = chrono::duration< double, milli >( end - start ).count();
+
+	// Lists with positions of each token (tokens' positions among review's tokens).
+	start = chrono::steady_clock::now();
+	for( unsigned index = 0; index < keys.size(); ++index )
+		for( unsigned token = 0; token < keys[ index ].size(); ++token )
+			positional[ keys[ index ][ token ] ].add( index, token );
+	end = chrono::steady_clock::now();
+	double positional_ms = chrono::duration< double, milli >( end - start ).count();
+
+	// Memory used by both, and by the most frequent word alone.
+	size_t list_bytes = 0, vector_bytes = 0, positional_bytes = 0;
+	unsigned top = 0;
+	for( unsigned k = 0; k < lists.size(); ++k )
+	{
+		list_bytes += lists[ k ].getEncodedBytes();
+		positional_bytes += positional[ k ].getEncodedBytes();
+		vector_bytes += vectors[ k ].size() * sizeof( unsigned );
+		if( lists[ k ].size() > lists[ top ].size() )
+			top = k;
+	}
+
+	cout << "-- posting lists --\n"
+			<< fixed << setprecision( 1 )
+			<< "vector + scan  = " << vector_ms << " ms, " << vector_bytes << " bytes\n"
+			<< "PostingList    = " << list_ms << " ms, " << list_bytes << " bytes\n"
+			<< "  + positions  = " << positional_ms << " ms, " << positional_bytes << " bytes\n"
+			<< "most frequent  = \"" << h.getData( top )->getWord() << "\" in " << lists[ top ].size()
+			<< " reviews: " << vectors[ top ].size() * sizeof( unsigned ) << " -> "
+			<< lists[ top ].getEncodedBytes() << " bytes\n" << endl;
+}
+
+// Count every token in a table while ranking words by score: either by removing and
+// reinserting a word's node on every occurrence (as ReviewAnalyzer used to), or by
+// building the ranking once after the last token.
+void benchmarkRanking( const vector< string > &tokens )
+{
+	for( bool deferred : { false, true } )
+	{
+		StringHashTable h( 100001 );
+		AvlTree ranking( SCORE );
+		bool is_inserted;
+
+		auto start = chrono::steady_clock::now();
+		for( unsigned i = 0; i < tokens.size(); ++i )
+		{
+			uint64_t hash_value = h.hashOf( tokens[ i ] );
+			StringHashData *data = h.getData(
+					h.findOrInsert( tokens[ i ], hash_value, i % 5, i, &is_inserted ) );
+
+			if( deferred )
+			{
+				if( !is_inserted )
+					data->recalculateScore( i % 5, i );
+			}
+			else if( is_inserted )
+				ranking.insert( data );
+			else
+			{
+				ranking.remove( data );
+				data->recalculateScore( i % 5, i );
+				ranking.insert( data );
+			}
+		}
+		auto end = chrono::steady_clock::now();
+		double ingest_ms = chrono::duration< double, milli >( end - start ).count();
+
+		// Deferred ranking is built from every word at once.
+		start = chrono::steady_clock::now();
+		if( deferred )
+		{
+			vector< StringHashData* > words;
+			for( unsigned key = 0; key < h.getKeysAmount(); ++key )
+				words.push_back( h.getData( key ) );
+			ranking.build( words );
+		}
+		end = chrono::steady_clock::now();
+		double build_ms = chrono::duration< double, milli >( end - start ).count();
+
+		int height = ranking.getRoot()->getHeight();
+
+		// Teardown: removing words one by one (as clear() used to) against releasing the
+		// pool of nodes at once.
+		start = chrono::steady_clock::now();
+		if( deferred )
+			ranking.clear();
+		else
+			for( unsigned key = 0; key < h.getKeysAmount(); ++key )
+				ranking.remove( h.getData( key ) );
+		end = chrono::steady_clock::now();
+		double teardown_ms = chrono::duration< double, milli >( end - start ).count();
+
+		cout << fixed << setprecision( 1 )
+				<< setw( 8 ) << ( deferred ? "deferred" : "eager" ) << " : ingest "
+				<< setw( 8 ) << ingest_ms << " ms, build " << setw( 6 ) << build_ms << " ms, teardown "
+				<< setw( 6 ) << teardown_ms << " ms, root's height " << height << endl;
+	}
+	cout << "(teardown: eager removes each word, deferred clears the tree)\n" << endl;
+}
+
+// Answer the same ranking queries with an AVL tree and with a frozen sorted array, both
+// built from a given amount of synthetic words (Zipf-like frequencies, random labels).
+void benchmarkRankingIndex( unsigned words_amount )
+{
+	deque< StringHashData > words;
+	vector< StringHashData* > pointers;
+	mt19937 random( 42 );
+	for( unsigned i = 0; i < words_amount; ++i )
+	{
+		words.emplace_back( "w", random() % 5, i );
+		for( unsigned j = 1; j < 1000 / ( i % 1000 + 1 ); ++j )
+			words.back().recalculateScore( random() % 5, j );
+		pointers.push_back( &words.back() );
+	}
+
+	// Queries: keys to count, words to rank.
+	vector< double > keys;
+	vector< StringHashData* > ranked;
+	for( unsigned i = 0; i < 1000000; ++i )
+	{
+		keys.push_back( ( random() % 4001 ) / 1000.0 );
+		ranked.push_back( pointers[ random() % pointers.size() ] );
+	}
+
+	AvlTree tree( SCORE );
+	FrozenRanking frozen( SCORE );
+	for( bool is_frozen : { false, true } )
+	{
+		auto start = chrono::steady_clock::now();
+		is_frozen ? frozen.build( pointers ) : tree.build( pointers );
+		auto end = chrono::steady_clock::now();
+		double build_ms = chrono::duration< double, milli >( end - start ).count();
+
+		// Percentiles of random keys (two searches each).
+		start = chrono::steady_clock::now();
+		for( auto key : keys )
+			is_frozen ? frozen.getPercentile( key ) : tree.getPercentile( key );
+		end = chrono::steady_clock::now();
+		double percentile_ns = chrono::duration< double, nano >( end - start ).count() / keys.size();
+
+		// Ranks of random words (a search, then greater keys are counted).
+		start = chrono::steady_clock::now();
+		for( unsigned i = 0; i < 10000; ++i )
+			is_frozen ? frozen.getRank( ranked[ i ] ) : tree.getRank( ranked[ i ] );
+		end = chrono::steady_clock::now();
+		double rank_ns = chrono::duration< double, nano >( end - start ).count() / 10000;
+
+		// Whole ranking, greatest keys first.
+		vector< StringHashData* > walk;
+		start = chrono::steady_clock::now();
+		is_frozen ? frozen.getGreatestKeys( words_amount, walk ) : tree.getGreatestKeys( words_amount, walk );
+		end = chrono::steady_clock::now();
+		double walk_ms = chrono::duration< double, milli >( end - start ).count();
+
+		cout << fixed << setprecision( 1 )
+				<< setw( 13 ) << ( is_frozen ? "FrozenRanking" : "AvlTree" ) << setw( 10 ) << words_amount
+				<< setw( 9 ) << build_ms << setw( 12 ) << percentile_ns << setw( 9 ) << rank_ns
+				<< setw( 9 ) << walk_ms << setw( 9 )
+				<< ( is_frozen ? frozen.getAllocatedBytes() : tree.getAllocatedBytes() ) / double( words_amount )
+				<< '\n';
+	}
+}
+
+// Update an eagerly maintained score ranking for every token of a synthetic stream whose
+// words follow Zipf's law (frequency of the r-th word proportional to 1 / r), so most
+// words share a few keys (frequency 1, scores of a single label), then search for random
+// words and remove every word.
+void benchmarkZipf( unsigned words_amount, unsigned tokens_amount )
+{
+	// Cumulative weights of words' ranks.
+	vector< double > cumulative( words_amount );
+	double total = 0.0;
+	for( unsigned r = 0; r < words_amount; ++r )
+		cumulative[ r ] = total += 1.0 / ( r + 1 );
+
+	mt19937 random( 7 );
+	uniform_real_distribution< double > uniform( 0.0, total );
+	deque< StringHashData > words;
+	vector< bool > is_seen( words_amount, false );
+	for( unsigned i = 0; i < words_amount; ++i )
+		words.emplace_back( "w", random() % 5, i );
+
+	// Ingest: a word's first token inserts it, later ones move it (remove, rescore, insert).
+	AvlTree ranking( SCORE );
+	auto start = chrono::steady_clock::now();
+	for( unsigned t = 0; t < tokens_amount; ++t )
+	{
+		unsigned r = lower_bound( cumulative.begin(), cumulative.end(), uniform( random ) ) - cumulative.begin();
+		r = min( r, words_amount - 1 );
+		if( !is_seen[ r ] )
+			is_seen[ r ] = true;
+		else
+		{
+			ranking.remove( &words[ r ] );
+			words[ r ].recalculateScore( t % 5, t );
+		}
+		ranking.insert( &words[ r ] );
+	}
+	auto end = chrono::steady_clock::now();
+	double ingest_ns = chrono::duration< double, nano >( end - start ).count() / tokens_amount;
+
+	// Searches for random words (seen or not).
+	start = chrono::steady_clock::now();
+	unsigned found = 0;
+	for( unsigned i = 0; i < 100000; ++i )
+		found += ranking.search( &words[ random() % words_amount ] );
+	end = chrono::steady_clock::now();
+	double search_ns = chrono::duration< double, nano >( end - start ).count() / 100000;
+
+	// Remove every word, one by one.
+	unsigned size = ranking.getSize();
+	start = chrono::steady_clock::now();
+	for( unsigned r = 0; r < words_amount; ++r )
+		if( is_seen[ r ] )
+			ranking.remove( &words[ r ] );
+	end = chrono::steady_clock::now();
+	double remove_ms = chrono::duration< double, milli >( end - start ).count();
+
+	cout << fixed << setprecision( 1 )
+			<< setw( 8 ) << words_amount << setw( 10 ) << tokens_amount << setw( 8 ) << size
+			<< setw( 11 ) << ingest_ns << setw( 11 ) << search_ns << setw( 11 ) << remove_ms
+			<< setw( 7 ) << ranking.isEmpty() << " (" << found << " found)\n";
+}
+
+// Count every token in a table while keeping heaps of the 100 most positive, most negative
+// and most frequent words, then answer a "print+ 10" from the heap against building the
+// score ranking and walking it.
+void benchmarkTopKeys( const vector< string > &tokens )
+{
+	StringHashTable h( 100001 );
+	TopKeys most_positive( SCORE, true ), most_negative( SCORE, false ), most_frequent( FREQUENCY, true );
+	bool is_inserted;
+
+	auto start = chrono::steady_clock::now();
+	for( unsigned i = 0; i < tokens.size(); ++i )
+	{
+		uint64_t hash_value = h.hashOf( tokens[ i ] );
+		StringHashData *data = h.getData(
+				h.findOrInsert( tokens[ i ], hash_value, i % 5, i, &is_inserted ) );
+		if( !is_inserted )
+			data->recalculateScore( i % 5, i );
+
+		most_positive.update( data );
+		most_negative.update( data );
+		most_frequent.update( data );
+	}
+	auto end = chrono::steady_clock::now();
+	double ingest_ms = chrono::duration< double, milli >( end - start ).count();
+
+	// Heaps answer while no word in them got weaker than a word left out.
+	bool exact[] = { most_positive.isExact(), most_negative.isExact(), most_frequent.isExact() };
+
+	// Full ranking: build it, then walk its 10 greatest keys.
+	vector< StringHashData* > words, greatest;
+	for( unsigned key = 0; key < h.getKeysAmount(); ++key )
+		words.push_back( h.getData( key ) );
+	AvlTree ranking( SCORE );
+	start = chrono::steady_clock::now();
+	ranking.build( words );
+	end = chrono::steady_clock::now();
+	double build_ms = chrono::duration< double, milli >( end - start ).count();
+
+	start = chrono::steady_clock::now();
+	for( unsigned i = 0; i < 10000; ++i )
+		ranking.getGreatestKeys( 10, greatest );
+	end = chrono::steady_clock::now();
+	double walk_ns = chrono::duration< double, nano >( end - start ).count() / 10000;
+
+	// Heap refilled from the full ranking (as ReviewAnalyzer does when it isn't exact).
+	ranking.getGreatestKeys( 101, greatest );
+	StringHashData *next = greatest.back();
+	greatest.pop_back();
+	most_positive.refill( greatest, next );
+
+	start = chrono::steady_clock::now();
+	for( unsigned i = 0; i < 10000; ++i )
+		most_positive.get( 10, greatest );
+	end = chrono::steady_clock::now();
+	double heap_ns = chrono::duration< double, nano >( end - start ).count() / 10000;
+
+	cout << fixed << setprecision( 1 ) << boolalpha
+			<< "ingest with 3 heaps " << ingest_ms << " ms (exact after ingest: positive "
+			<< exact[ 0 ] << ", negative " << exact[ 1 ] << ", frequent " << exact[ 2 ] << ")\n"
+			<< "top 10: build " << build_ms << " ms + walk " << walk_ns << " ns, heap "
+			<< heap_ns << " ns\n" << endl;
+}
+
+// Answer top 10 scores among words seen at least f times from ScoreFrequencyIndex, against
+// a full scan filtering every word and sorting those left.
+void benchmarkSupport( const vector< string > &tokens )
+{
+	// Words from movie reviews, each seen once per token.
+	StringHashTable h( 100001 );
+	bool is_inserted;
+	for( unsigned i = 0; i < tokens.size(); ++i )
+	{
+		StringHashData *data = h.getData( h.findOrInsert( tokens[ i ], h.hashOf( tokens[ i ] ),
+				i % 5, i, &is_inserted ) );
+		if( !is_inserted )
+			data->recalculateScore( i % 5, i );
+	}
+	vector< StringHashData* > words;
+	for( unsigned key = 0; key < h.getKeysAmount(); ++key )
+		words.push_back( h.getData( key ) );
+
+	ScoreFrequencyIndex index;
+	auto start = chrono::steady_clock::now();
+	index.build( words );
+	auto end = chrono::steady_clock::now();
+	double build_ms = chrono::duration< double, milli >( end - start ).count();
+
+	cout << "build " << words.size() << " words: " << fixed << setprecision( 2 ) << build_ms << " ms\n"
+			<< " minfreq  words     index ns      scan ns\n";
+	vector< StringHashData* > greatest, filtered;
+	for( unsigned min_frequency : { 2, 10, 50, 500 } )
+	{
+		// Index: top 10 among words seen often enough.
+		start = chrono::steady_clock::now();
+		for( unsigned i = 0; i < 1000; ++i )
+			index.getGreatestScores( 10, min_frequency, greatest );
+		end = chrono::steady_clock::now();
+		double index_ns = chrono::duration< double, nano >( end - start ).count() / 1000;
+
+		// Scan: filter every word, then take the top 10 of those left.
+		start = chrono::steady_clock::now();
+		for( unsigned i = 0; i < 1000; ++i )
+		{
+			filtered.clear();
+			for( auto d : words )
+				if( d->getFrequency() >= min_frequency )
+					filtered.push_back( d );
+			unsigned amount = min( ( size_t ) 10, filtered.size() );
+			partial_sort( filtered.begin(), filtered.begin() + amount, filtered.end(),
+					[]( StringHashData *a, StringHashData *b ) { return a->getScore() > b->getScore(); } );
+		}
+		end = chrono::steady_clock::now();
+		double scan_ns = chrono::duration< double, nano >( end - start ).count() / 1000;
+
+		cout << setw( 8 ) << min_frequency << setw( 7 ) << index.countWithSupport( min_frequency )
+				<< setw( 13 ) << setprecision( 0 ) << index_ns << setw( 13 ) << scan_ns << '\n';
+	}
+	cout << endl;
+}
+
+// Insert every token from a given amount of threads, each one taking a slice of tokens.
+void benchmarkConcurrent( unsigned threads_amount, const vector< string > &tokens )
+{
+	ConcurrentStringHashTable h( 100001 );
+	vector< thread > threads;
+
+	auto start = chrono::steady_clock::now();
+	for( unsigned t = 0; t < threads_amount; ++t )
+		threads.emplace_back( [ &h, &tokens, t, threads_amount ]()
+		{
+			for( unsigned i = t; i < tokens.size(); i += threads_amount )
+				h.insert( tokens[ i ], 2, i );
+		} );
+	for( auto &worker : threads )
+		worker.join();
+	auto end = chrono::steady_clock::now();
+
+	cout << fixed << setprecision( 1 )
+			<< setw( 2 ) << threads_amount << " threads : "
+			<< chrono::duration< double, milli >( end - start ).count() << " ms ("
+			<< h.getUsedAmount() << " words, " << h.getShardsAmount() << " shards)" << endl;
+}
+
+
+int main()
+{
+	cout << "> StringHashTable : benchmark" << endl;
+
+	// Vocabulary from movie reviews.
+	vector< string > tokens = readTokens( "Files/movieReviews.txt" );
+	if( tokens.empty() )
+	{
+		cout << "Couldn't read \"Files/movieReviews.txt\"." << endl;
+		return 1;
+	}
+
+	// Distinct words, each turned into a missing word by appending a character.
+	StringHashTable distinct( 100001 );
+	vector< string > vocabulary, missing;
+	for( auto &word : tokens )
+		if( distinct.insert( word, 2, 0 ) )
+		{
+			vocabulary.push_back( word );
+			missing.push_back( word + "#" );
+		}
+
+	cout << tokens.size() << " tokens, " << vocabulary.size() << " distinct words\n" << endl;
+
+	benchmark( "POLYNOMIAL", HashPolicy::POLYNOMIAL, tokens, vocabulary, missing );
+	benchmark( "SEEDED", HashPolicy::SEEDED, tokens, vocabulary, missing );
+
+	benchmarkRehash( "FULL", RehashMode::FULL, tokens );
+	benchmarkRehash( "INCREMENTAL", RehashMode::INCREMENTAL, tokens );
+
+	benchmarkRemove( vocabulary, missing );
+
+	cout << "-- capacity --\n"
+			<< "      policy    max     size    load  B/entry   insert      hit     miss (ns)\n";
+	for( double max_load : { 0.5, 0.7, 0.875 } )
+	{
+		benchmarkCapacity( "PRIME_TABLE", CapacityPolicy::PRIME_TABLE, max_load, tokens, missing );
+		benchmarkCapacity( "POWER_OF_TWO", CapacityPolicy::POWER_OF_TWO, max_load, tokens, missing );
+	}
+	cout << endl;
+
+	cout << "-- probing (POWER_OF_TWO; probes are groups for DOUBLE_HASHING, positions for ROBIN_HOOD) --\n"
+			<< "          mode    max   insert      hit     miss  removed+  probes (hit / miss)\n";
+	for( double max_load : { 0.7, 0.875, 0.95 } )
+	{
+		benchmarkProbing( "DOUBLE_HASHING", ProbingMode::DOUBLE_HASHING, max_load, tokens, vocabulary, missing );
+		benchmarkProbing( "ROBIN_HOOD", ProbingMode::ROBIN_HOOD, max_load, tokens, vocabulary, missing );
+	}
+	cout << "(removed+: misses after removing half of the words, in ns)\n" << endl;
+
+	benchmarkPostings( "Files/movieReviews.txt" );
+
+	cout << "-- score ranking --" << endl;
+	benchmarkRanking( tokens );
+
+	cout << "-- ranking index (synthetic words) --\n"
+			<< "        index     words  build ms  percentile  rank ns  walk ms  B/word\n";
+	for( unsigned words_amount : { 20000, 1000000 } )
+		benchmarkRankingIndex( words_amount );
+	cout << "(percentile in ns per query)\n" << endl;
+
+	cout << "-- eager ranking, Zipf vocabulary --\n"
+			<< "   words    tokens  ranked  ingest ns  search ns  remove ms  empty\n";
+	for( unsigned words_amount : { 20000, 200000 } )
+		benchmarkZipf( words_amount, 2000000 );
+	cout << "(ingest and search in ns per token or search)\n" << endl;
+
+	cout << "-- top keys --" << endl;
+	benchmarkTopKeys( tokens );
+
+	cout << "-- top 10 scores among frequent words --" << endl;
+	benchmarkSupport( tokens );
+
+	cout << "-- concurrent insertion (" << thread::hardware_concurrency() << " cores) --" << endl;
+	for( unsigned threads_amount = 1; threads_amount <= 8; threads_amount *= 2 )
+		benchmarkConcurrent( threads_amount, tokens );
+	cout << endl;
+
+	cout << "> StringHashTable : end of benchmark" << endl;
+}
+
+#endif /* STRINGHASHTABLE_BENCH_ */
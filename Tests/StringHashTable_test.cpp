@@ -29,10 +29,10 @@ int main()
 	// Testing insert() and rehash() methods.
 	cout << "h.insert(...): [4 elements]\n"
 			<< boolalpha
-			<< h.insert( "semester", 0 ) << '\n'
-			<< h.insert( "gaming", 4 ) << '\n'
-			<< h.insert( "budweiser", 4 ) << '\n'
-			<< h.insert( "studying", 2 )
+			<< h.insert( "semester", 0, 0 ) << '\n'
+			<< h.insert( "gaming", 4, 0 ) << '\n'
+			<< h.insert( "budweiser", 4, 0 ) << '\n'
+			<< h.insert( "studying", 2, 0 )
 			<< endl;
 
 	// Testing getSize(), getUsedRate() and getCollisionsNum() methods.
@@ -66,6 +66,60 @@ int main()
 			<< "studying  = " << h.search( "studying", &k3 )
 			<< endl;
 
+	// Testing getTombstonesAmount() method and reuse of removed words' keys.
+	unsigned k4;
+	cout << "\nh.getTombstonesAmount() = " << h.getTombstonesAmount()
+			<< "\nh.insert( \"exam\", 1, 0, &k4 ) = " << h.insert( "exam", 1, 0, &k4 )
+			<< "\nkey reused             = " << ( k4 <= 3 )
+			<< endl;
+
+	// Testing compact() method.
+	h.compact();
+	cout << "\nh.compact():\n"
+			<< "h.getTombstonesAmount() = " << h.getTombstonesAmount() << '\n'
+			<< "h.getUsedAmount()       = " << h.getUsedAmount() << '\n'
+			<< "exam                    = " << h.search( "exam" ) << '\n'
+			<< "semester                = " << h.search( "semester" )
+			<< endl;
+
+	// Testing sizing policies and setMaxLoadFactor() method.
+	StringHashTable p( 100, HashPolicy::SEEDED, 0, CapacityPolicy::POWER_OF_TWO );
+	StringHashTable q( 100, HashPolicy::SEEDED, 0, CapacityPolicy::PRIME_TABLE );
+	cout << "\nPOWER_OF_TWO getSize() = " << p.getSize()
+			<< "\nPRIME_TABLE getSize()  = " << q.getSize()
+			<< "\np.setMaxLoadFactor( 0.875 ) = " << p.setMaxLoadFactor( 0.875 )
+			<< "\np.setMaxLoadFactor( 1.0 )   = " << p.setMaxLoadFactor( 1.0 )
+			<< "\np.getMaxRate()              = " << p.getMaxRate()
+			<< endl;
+
+	// Testing Robin Hood probing: removal shifts words back, leaving no tombstones.
+	StringHashTable r( 16, HashPolicy::SEEDED, 0, CapacityPolicy::POWER_OF_TWO, 0.875,
+			ProbingMode::ROBIN_HOOD );
+	for( string word : { "semester", "gaming", "budweiser", "studying", "exam", "party" } )
+		r.insert( word, 2, 0 );
+	r.remove( "gaming" );
+	cout << "\nROBIN_HOOD getUsedAmount()       = " << r.getUsedAmount()
+			<< "\nROBIN_HOOD getTombstonesAmount() = " << r.getTombstonesAmount()
+			<< "\nr.search( \"gaming\" )             = " << r.search( "gaming" )
+			<< "\nr.search( \"party\" )              = " << r.search( "party" )
+			<< endl;
+
+	// Testing reserve() method: reserved words fit without rehashing (reserve() itself
+	// is the only rehash).
+	StringHashTable v( 16 );
+	v.reserve( 1000 );
+	unsigned reserved_size = v.getSize();
+	for( unsigned i = 0; i < 1000; ++i )
+		v.insert( "word" + to_string( i ), 2, 0 );
+	cout << "\nv.reserve( 1000 ): getSize() = " << reserved_size
+			<< "\nafter 1000 insertions: getSize() = " << v.getSize()
+			<< ", getRehashesNum() = " << v.getRehashesNum()
+			<< endl;
+
+	// Testing getStats() method.
+	cout << '\n';
+	h.getStats().print( cout, "h.getStats()" );
+
 	cout << "> StringHashTable : end of main()" << endl;
 }
 
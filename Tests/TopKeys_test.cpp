@@ -0,0 +1,152 @@
+/**
+ * Main function to test TopKeys class.
+ *
+ *  Created on: October 17th, 2026
+ *     Authors: Aline Weber
+ *              Renan Kummer
+ */
+
+// Defines which main() function to use.
+#include "MainControl.cpp"
+#ifdef TOPKEYS_TEST_
+
+// Libraries:
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <random>
+#include "../Classes/TopKeys.h"
+#include "../Classes/FrozenRanking.h"
+
+using namespace std;
+
+
+int main()
+{
+	cout << "> TopKeys : main()" << endl;
+
+	// Data to be ranked (scores are rounded to labels: 4, 3, 4, 3, 4).
+	StringHashData d0( "d0", 3.52, 0 );
+	StringHashData d1( "d1", 3.24, 1 );
+	StringHashData d2( "d2", 3.52, 2 );
+	StringHashData d3( "d3", 3.24, 3 );
+	StringHashData d4( "d4", 3.521, 4 );
+
+	// Testing constructor and update() method.
+	TopKeys top( SCORE, true, 3 );
+	for( StringHashData *d : { &d0, &d1, &d2, &d3, &d4 } )
+		top.update( d );
+	vector< StringHashData* > words;
+	cout << boolalpha << "update( d0 ~ d4 ): getSize() = " << top.getSize()
+			<< ", isExact() = " << top.isExact()
+			<< ", get( 3 ) = " << top.get( 3, words ) << " ->";
+	for( auto d : words )
+		cout << ' ' << d->getWord();
+	cout << ", get( 4 ) = " << top.get( 4, words ) << '\n';
+
+	// Testing printKeys() method.
+	top.printKeys( 2 );
+
+	// A word in the heap getting weaker than a word left out.
+	d4.recalculateScore( 0.0, 1 );
+	top.update( &d4 );
+	cout << "d4 weaker: isExact() = " << top.isExact() << ", printKeys( 3 ) = " << top.printKeys( 3 ) << '\n';
+
+	// Testing refill() method.
+	top.refill( { &d2, &d0, &d3 }, &d1 );
+	cout << "refill( d2, d0, d3; d1 ): isExact() = " << top.isExact() << '\n';
+	top.printKeys( 3 );
+
+	// Testing remove() method.
+	top.remove( &d0 );
+	cout << "remove( d0 ): getSize() = " << top.getSize() << ", isExact() = " << top.isExact() << '\n';
+
+	// Random updates and removals: whenever heaps answer, they must match a full ranking;
+	// when they can't, they're refilled from it.
+	deque< StringHashData > many;
+	vector< bool > removed;
+	for( unsigned i = 0; i < 5000; ++i )
+	{
+		many.emplace_back( "w", i % 5, i );
+		removed.push_back( false );
+	}
+
+	mt19937 random( 17 );
+	TopKeys greatest_score( SCORE, true, 20 );
+	TopKeys lowest_score( SCORE, false, 20 );
+	TopKeys greatest_frequency( FREQUENCY, true, 20 );
+	TopKeys *heaps[] = { &greatest_score, &lowest_score, &greatest_frequency };
+	for( auto &d : many )
+		for( TopKeys *heap : heaps )
+			heap->update( &d );
+
+	unsigned answers = 0, refills = 0, mismatches = 0;
+	for( unsigned step = 1; step <= 200000; ++step )
+	{
+		// Change a word's score (or remove it, once in a while).
+		unsigned i = random() % many.size();
+		if( removed[ i ] )
+			continue;
+		if( random() % 1000 == 0 )
+		{
+			removed[ i ] = true;
+			for( TopKeys *heap : heaps )
+				heap->remove( &many[ i ] );
+		}
+		else
+		{
+			many[ i ].recalculateScore( random() % 5, step );
+			for( TopKeys *heap : heaps )
+				heap->update( &many[ i ] );
+		}
+
+		// Compare heaps with full rankings now and then.
+		if( step % 1000 != 0 )
+			continue;
+
+		vector< StringHashData* > alive;
+		for( unsigned j = 0; j < many.size(); ++j )
+			if( !removed[ j ] )
+				alive.push_back( &many[ j ] );
+		FrozenRanking score( SCORE ), frequency( FREQUENCY );
+		score.build( alive );
+		frequency.build( alive );
+
+		for( unsigned h = 0; h < 3; ++h )
+		{
+			vector< StringHashData* > expected;
+			if( h == 0 )
+				score.getGreatestKeys( 21, expected );
+			else if( h == 1 )
+				score.getLowestKeys( 21, expected );
+			else
+				frequency.getGreatestKeys( 21, expected );
+
+			vector< StringHashData* > found;
+			StringHashData *next = expected.back();
+			expected.pop_back();
+			if( heaps[ h ]->get( 20, found ) )
+			{
+				++answers;
+				mismatches += ( found != expected );
+			}
+			else
+			{
+				++refills;
+				heaps[ h ]->refill( expected, next );
+				mismatches += !heaps[ h ]->get( 20, found ) || found != expected;
+			}
+		}
+	}
+	cout << "\nrandom updates (5000 words, 3 heaps of 20): answers + refills = "
+			<< answers + refills << ", answered = " << ( answers > 0 )
+			<< ", mismatches = " << mismatches << endl;
+
+	// Testing clear() method.
+	top.clear();
+	cout << "top.clear(): getSize() = " << top.getSize() << ", isExact() = " << top.isExact() << endl;
+
+	cout << "> TopKeys : end of main()" << endl;
+}
+
+#endif /* TOPKEYS_TEST_ */